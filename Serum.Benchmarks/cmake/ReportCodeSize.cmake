@@ -0,0 +1,30 @@
+# Reports the code size added by each Get<T> instantiation.
+# Expects BASELINE_OBJECT, INSTANTIATED_OBJECT and NUMBER_OF_TYPES to be defined, and optionally SIZE_EXECUTABLE.
+
+function(serum_get_code_size object result)
+	if (SIZE_EXECUTABLE)
+		execute_process(
+			COMMAND "${SIZE_EXECUTABLE}" "${object}"
+			OUTPUT_VARIABLE sizeOutput
+			RESULT_VARIABLE sizeResult)
+
+		# Berkeley format: the first column of the second line is the size of the code and read-only data.
+		if (sizeResult EQUAL 0 AND sizeOutput MATCHES "\n[ \t]*([0-9]+)")
+			set(${result} ${CMAKE_MATCH_1} PARENT_SCOPE)
+			return()
+		endif()
+	endif()
+
+	file(SIZE "${object}" fileSize)
+	set(${result} ${fileSize} PARENT_SCOPE)
+endfunction()
+
+serum_get_code_size("${BASELINE_OBJECT}" baselineSize)
+serum_get_code_size("${INSTANTIATED_OBJECT}" instantiatedSize)
+
+math(EXPR totalSize "${instantiatedSize} - ${baselineSize}")
+math(EXPR sizePerGet "${totalSize} / ${NUMBER_OF_TYPES}")
+
+message(STATUS "Baseline code size: ${baselineSize} bytes")
+message(STATUS "Code size with ${NUMBER_OF_TYPES} Get<T> instantiations: ${instantiatedSize} bytes")
+message(STATUS "Code size per Get<T> instantiation: ${sizePerGet} bytes")
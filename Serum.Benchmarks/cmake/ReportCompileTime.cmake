@@ -0,0 +1,53 @@
+# Reports the cost of including each Serum header in a translation unit.
+# Expects COMPILER, STANDARD_FLAG, INCLUDE_DIRECTORY, OUTPUT_DIRECTORY, HEADERS and REPETITIONS to be defined.
+# The number of preprocessed lines is always reported. The parse time is reported with CMake 3.23 or later,
+# which can measure sub-second timestamps.
+
+function(serum_get_time_in_microseconds result)
+	string(TIMESTAMP seconds "%s")
+	string(TIMESTAMP microseconds "%f")
+	set(${result} "${seconds}${microseconds}" PARENT_SCOPE)
+endfunction()
+
+string(REPLACE "," ";" headers "${HEADERS}")
+
+foreach(header IN LISTS headers)
+	string(MAKE_C_IDENTIFIER "${header}" sourceName)
+	set(source "${OUTPUT_DIRECTORY}/${sourceName}.cpp")
+	file(WRITE "${source}" "#include \"${header}\"\n")
+
+	execute_process(
+		COMMAND "${COMPILER}" ${STANDARD_FLAG} "-I${INCLUDE_DIRECTORY}" -E "${source}"
+		OUTPUT_VARIABLE preprocessed
+		RESULT_VARIABLE preprocessResult)
+
+	if (NOT preprocessResult EQUAL 0)
+		message(FATAL_ERROR "Failed to preprocess ${header}.")
+	endif()
+
+	string(REGEX MATCHALL "\n" lines "${preprocessed}")
+	list(LENGTH lines numberOfLines)
+
+	if (CMAKE_VERSION VERSION_LESS 3.23)
+		message(STATUS "${header}: ${numberOfLines} preprocessed lines")
+		continue()
+	endif()
+
+	serum_get_time_in_microseconds(start)
+
+	foreach(repetition RANGE 1 ${REPETITIONS})
+		execute_process(
+			COMMAND "${COMPILER}" ${STANDARD_FLAG} "-I${INCLUDE_DIRECTORY}" -fsyntax-only "${source}"
+			RESULT_VARIABLE compileResult)
+
+		if (NOT compileResult EQUAL 0)
+			message(FATAL_ERROR "Failed to compile ${header}.")
+		endif()
+	endforeach()
+
+	serum_get_time_in_microseconds(end)
+
+	math(EXPR millisecondsPerCompile "(${end} - ${start}) / (${REPETITIONS} * 1000)")
+
+	message(STATUS "${header}: ${numberOfLines} preprocessed lines, ${millisecondsPerCompile} ms to parse")
+endforeach()
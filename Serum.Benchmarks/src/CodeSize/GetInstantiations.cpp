@@ -0,0 +1,50 @@
+/// @file GetInstantiations.cpp
+/// Binds SERUM_CODE_SIZE_TYPES distinct types and, if SERUM_CODE_SIZE_INSTANTIATE_GET is non-zero, instantiates
+/// Get for each of them. Comparing the code size of the two builds gives the cost of each Get instantiation.
+
+#include "Serum/Serum.hpp"
+
+#ifndef SERUM_CODE_SIZE_TYPES
+#define SERUM_CODE_SIZE_TYPES 64
+#endif
+
+#ifndef SERUM_CODE_SIZE_INSTANTIATE_GET
+#define SERUM_CODE_SIZE_INSTANTIATE_GET 1
+#endif
+
+namespace Serum::Benchmarks::CodeSize
+{
+	template <int Index>
+	struct Service final
+	{
+		int value = Index;
+	};
+
+	template <int... Indices>
+	void BindAll(SerumContainer& container, std::integer_sequence<int, Indices...>)
+	{
+		(container.BindConstant<Service<Indices>>(Service<Indices>()), ...);
+	}
+
+	template <int... Indices>
+	int GetAll(SerumContainer& container, std::integer_sequence<int, Indices...>)
+	{
+		return (container.Get<Service<Indices>>().value + ... + 0);
+	}
+}
+
+int main()
+{
+	using namespace Serum::Benchmarks::CodeSize;
+
+	auto container = Serum::SerumContainer();
+	auto const indices = std::make_integer_sequence<int, SERUM_CODE_SIZE_TYPES>();
+
+	BindAll(container, indices);
+
+#if SERUM_CODE_SIZE_INSTANTIATE_GET
+	return GetAll(container, indices) == 0 ? 0 : 1;
+#else
+	return 0;
+#endif
+}
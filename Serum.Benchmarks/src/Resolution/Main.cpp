@@ -0,0 +1,251 @@
+/// @file Main.cpp
+/// Times Get and HasBinding for each kind of binding, and writes the time and heap allocations of each operation as JSON.
+/// Usage: Serum.Benchmarks [output file]
+
+#include "Serum/Serum.hpp"
+#include "Serum/Internal/Json.hpp"
+#include "Serum/Metrics/AllocationCounter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+SERUM_INSTALL_ALLOCATION_HOOKS();
+
+namespace Serum::Benchmarks::Resolution
+{
+	/// The time and heap allocations of one operation of a benchmark.
+	struct BenchmarkResult final
+	{
+		std::string name;
+		std::uint64_t iterations;
+		double nanosecondsPerOperation;
+		double allocationsPerOperation;
+		double bytesPerOperation;
+	};
+
+	/// A service with enough state that resolving it by value is not free.
+	struct Service
+	{
+		int value = 1;
+		double weight = 2.0;
+	};
+
+	struct SerumConstructedService final : Service
+	{
+		static SerumConstructedService* SerumConstructor(SerumContainer&, ResolutionContext&)
+		{
+			return new SerumConstructedService();
+		}
+	};
+
+	struct InjectedService final : Service
+	{
+		using SerumDependencies = Dependencies<int>;
+
+		explicit InjectedService(int const injected)
+		{
+			value = injected;
+		}
+	};
+
+	class ServiceResolver final : public SerumResolver<Service>
+	{
+		public:
+			Service Resolve(ResolutionContext&) override
+			{
+				return Service();
+			}
+	};
+
+	// Each batch runs for at least this long, so the clock's resolution and overhead are negligible.
+	constexpr auto MinimumBatchTime = std::chrono::milliseconds(20);
+
+	// The reported time is the median of this many batches, so that one preempted batch does not skew it.
+	constexpr auto BatchCount = 7;
+
+	/// Prevents the compiler from discarding a value which is otherwise unused.
+	template <typename T>
+	void DoNotOptimize(T const& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r"(&value) : "memory");
+#else
+		auto const volatile address = static_cast<void const*>(&value);
+		(void)address;
+#endif
+	}
+
+	template <typename TOperation>
+	[[nodiscard]] std::chrono::nanoseconds RunBatch(TOperation& operation, std::uint64_t const iterations)
+	{
+		auto const start = std::chrono::steady_clock::now();
+		for (auto iteration = std::uint64_t(0); iteration < iterations; ++iteration)
+		{
+			operation();
+		}
+
+		return std::chrono::steady_clock::now() - start;
+	}
+
+	/// Times an operation.
+	/// @param name The name of the benchmark.
+	/// @param operation The operation to time.
+	/// @returns The median time of the operation, and the mean number of allocations it made.
+	template <typename TOperation>
+	[[nodiscard]] BenchmarkResult Run(std::string name, TOperation operation)
+	{
+		// Doubling the iterations until a batch is long enough also warms up the caches and branch predictors.
+		auto iterations = std::uint64_t(1);
+		while (RunBatch(operation, iterations) < MinimumBatchTime)
+		{
+			iterations *= 2;
+		}
+
+		auto batchTimes = std::vector<std::chrono::nanoseconds>();
+		for (auto batch = 0; batch < BatchCount; ++batch)
+		{
+			batchTimes.push_back(RunBatch(operation, iterations));
+		}
+
+		std::nth_element(batchTimes.begin(), batchTimes.begin() + BatchCount / 2, batchTimes.end());
+
+		// Allocations are counted in a separate batch, so that reading the counters is not part of the timed batches.
+		auto const allocationsBefore = Metrics::AllocationCounter::GetThreadCounts();
+		(void)RunBatch(operation, iterations);
+		auto const allocationsAfter = Metrics::AllocationCounter::GetThreadCounts();
+
+		auto const perOperation = [iterations](auto const total) { return static_cast<double>(total) / static_cast<double>(iterations); };
+
+		return BenchmarkResult{
+			std::move(name),
+			iterations,
+			perOperation(batchTimes[BatchCount / 2].count()),
+			perOperation(allocationsAfter.count - allocationsBefore.count),
+			perOperation(allocationsAfter.bytes - allocationsBefore.bytes)
+		};
+	}
+
+	[[nodiscard]] std::vector<BenchmarkResult> RunAll()
+	{
+		auto container = SerumContainer();
+
+		// The names are constructed once, so that the results do not include constructing a std::string for each call.
+		auto const constantName = std::string("Constant");
+		auto const functionName = std::string("Function");
+		auto const resolverName = std::string("Resolver");
+		auto const toSelfName = std::string("ToSelf");
+		auto const rawPointerName = std::string("RawPointer");
+		auto const sharedPointerName = std::string("SharedPointer");
+		auto const singletonRawPointerName = std::string("SingletonRawPointer");
+		auto const singletonSharedPointerName = std::string("SingletonSharedPointer");
+		auto const missingName = std::string("Missing");
+		auto const constant = Service();
+
+		container.BindConstant<Service>(constant, constantName);
+		container.BindFunction<Service>([](ResolutionContext&) { return Service(); }, functionName);
+		container.BindResolver<Service, ServiceResolver>(resolverName);
+		container.BindToSelf<Service>(toSelfName);
+		container.BindToSelf<SerumConstructedService>();
+		container.BindConstant<int>(3);
+		container.BindToSelf<InjectedService>();
+		container.BindRawPointer<Service>(rawPointerName);
+		container.BindSharedPointer<Service>(sharedPointerName);
+		container.BindSingletonRawPointer<Service>(singletonRawPointerName);
+		container.BindSingletonSharedPointer<Service>(singletonSharedPointerName);
+
+		auto results = std::vector<BenchmarkResult>();
+
+		results.push_back(Run("Get/BindConstant", [&] { DoNotOptimize(container.Get<Service>(constantName)); }));
+		results.push_back(Run("Get/BindFunction", [&] { DoNotOptimize(container.Get<Service>(functionName)); }));
+		results.push_back(Run("Get/BindResolver", [&] { DoNotOptimize(container.Get<Service>(resolverName)); }));
+		results.push_back(Run("Get/BindToSelf", [&] { DoNotOptimize(container.Get<Service>(toSelfName)); }));
+		results.push_back(Run("Get/BindToSelf/SerumConstructor", [&] { DoNotOptimize(container.Get<SerumConstructedService>()); }));
+		results.push_back(Run("Get/BindToSelf/SerumDependencies", [&] { DoNotOptimize(container.Get<InjectedService>()); }));
+
+		// The pointer is deleted in the loop, so this includes the cost of freeing it.
+		results.push_back(Run("Get/BindRawPointer", [&]
+		{
+			auto const* const service = container.Get<Service*>(rawPointerName);
+			DoNotOptimize(service);
+			delete service;
+		}));
+
+		results.push_back(Run("Get/BindSharedPointer", [&] { DoNotOptimize(container.Get<std::shared_ptr<Service>>(sharedPointerName)); }));
+		results.push_back(Run("Get/BindSingletonRawPointer", [&] { DoNotOptimize(container.Get<Service*>(singletonRawPointerName)); }));
+		results.push_back(Run("Get/BindSingletonSharedPointer", [&] { DoNotOptimize(container.Get<std::shared_ptr<Service>>(singletonSharedPointerName)); }));
+		results.push_back(Run("GetSharedPointer/BindSharedPointer", [&] { DoNotOptimize(container.GetSharedPointer<Service>(sharedPointerName)); }));
+		results.push_back(Run("GetSharedPointer/BindSingletonSharedPointer", [&] { DoNotOptimize(container.GetSharedPointer<Service>(singletonSharedPointerName)); }));
+		results.push_back(Run("HasBinding/Hit", [&] { DoNotOptimize(container.HasBinding<Service>(functionName)); }));
+		results.push_back(Run("HasBinding/Miss", [&] { DoNotOptimize(container.HasBinding<Service>(missingName)); }));
+
+		return results;
+	}
+
+	[[nodiscard]] std::string ToJson(std::vector<BenchmarkResult> const& results)
+	{
+		auto json = std::ostringstream();
+		json << "{\"context\":{"
+			 << "\"serumVersion\":\"" << SERUM_VERSION_MAJOR << '.' << SERUM_VERSION_MINOR << '.' << SERUM_VERSION_PATCH << '"'
+#ifdef NDEBUG
+			 << ",\"optimized\":true"
+#else
+			 << ",\"optimized\":false"
+#endif
+			 << ",\"resolutionTracking\":" << SERUM_RESOLUTION_TRACKING
+#ifdef SERUM_HAS_OBSERVERS
+			 << ",\"observers\":true"
+#else
+			 << ",\"observers\":false"
+#endif
+#ifdef SERUM_ENABLE_METRICS
+			 << ",\"metrics\":true"
+#else
+			 << ",\"metrics\":false"
+#endif
+			 << ",\"countsAllocations\":" << (Metrics::AllocationCounter::IsInstalled() ? "true" : "false")
+			 << "},\"benchmarks\":[";
+
+		for (auto resultIndex = std::size_t(0); resultIndex < results.size(); ++resultIndex)
+		{
+			auto const& result = results[resultIndex];
+
+			json << (resultIndex == 0 ? "\n" : ",\n")
+				 << "{\"name\":" << Internal::ToJsonString(result.name)
+				 << ",\"iterations\":" << result.iterations
+				 << ",\"nanosecondsPerOperation\":" << result.nanosecondsPerOperation
+				 << ",\"allocationsPerOperation\":" << result.allocationsPerOperation
+				 << ",\"bytesPerOperation\":" << result.bytesPerOperation << "}";
+		}
+
+		json << "\n]}\n";
+
+		return json.str();
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	auto const json = Serum::Benchmarks::Resolution::ToJson(Serum::Benchmarks::Resolution::RunAll());
+
+	if (argumentCount < 2)
+	{
+		std::cout << json;
+		return EXIT_SUCCESS;
+	}
+
+	auto file = std::ofstream(arguments[1]);
+	file << json;
+
+	if (!file)
+	{
+		std::cerr << "Could not write " << arguments[1] << '\n';
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
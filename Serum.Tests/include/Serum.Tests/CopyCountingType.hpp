@@ -0,0 +1,42 @@
+/// @file CopyCountingType.hpp
+/// Defines a type which counts how many times it is copied, for use in tests.
+
+#ifndef SERUM_TESTS_COPY_COUNTING_TYPE_HPP
+#define SERUM_TESTS_COPY_COUNTING_TYPE_HPP
+
+namespace Serum
+{
+	struct CopyCountingType
+	{
+		inline static int numberOfCopies = 0;
+
+		int value = 0;
+
+		CopyCountingType() = default;
+
+		explicit CopyCountingType(int value)
+			: value(value)
+		{
+		}
+
+		CopyCountingType(CopyCountingType const& other)
+			: value(other.value)
+		{
+			++numberOfCopies;
+		}
+
+		CopyCountingType(CopyCountingType&& other) noexcept = default;
+
+		CopyCountingType& operator=(CopyCountingType const& other)
+		{
+			value = other.value;
+			++numberOfCopies;
+
+			return *this;
+		}
+
+		CopyCountingType& operator=(CopyCountingType&& other) noexcept = default;
+	};
+}
+
+#endif // SERUM_TESTS_COPY_COUNTING_TYPE_HPP
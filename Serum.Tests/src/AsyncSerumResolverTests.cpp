@@ -0,0 +1,280 @@
+/// @file AsyncSerumResolverTests.cpp
+/// Unit tests for asynchronous resolution with AsyncSerumResolver.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_COROUTINES
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Serum::AsyncSerumResolverTests
+{
+	class NameResolver final : public AsyncSerumResolver<std::string>
+	{
+		public:
+			Async::Task<std::string> Resolve(SerumContainer&, ResolutionContext&) override
+			{
+				co_return "Serum";
+			}
+	};
+
+	class GreetingResolver final : public AsyncSerumResolver<std::string>
+	{
+		public:
+			Async::Task<std::string> Resolve(SerumContainer& container, ResolutionContext& resolutionContext) override
+			{
+				auto const name = co_await container.GetAsync<std::string>(resolutionContext, "name");
+
+				co_return "Hello " + name;
+			}
+	};
+
+	class ThrowingResolver final : public AsyncSerumResolver<int>
+	{
+		public:
+			Async::Task<int> Resolve(SerumContainer&, ResolutionContext&) override
+			{
+				throw SerumException("Resolver failed.");
+				co_return 0;
+			}
+	};
+
+	class QueueExecutor final : public Async::SerumExecutor
+	{
+		public:
+			void Schedule(std::coroutine_handle<> handle) override
+			{
+				queue.push_back(handle);
+			}
+
+			void RunAll()
+			{
+				while (!queue.empty())
+				{
+					auto const handle = queue.front();
+					queue.erase(queue.begin());
+					handle.resume();
+				}
+			}
+
+		private:
+			std::vector<std::coroutine_handle<>> queue{};
+	};
+
+#ifdef SERUM_HAS_OBSERVERS
+	// Counts the resolutions which end on a different thread to the one they began on, which would unbalance
+	// the per-thread state kept by observers such as Observers::ResolutionProfiler.
+	class ThreadBalanceObserver final : public SerumObserver
+	{
+		public:
+			void OnResolveBegin(Bindings::BindingKey const& key, std::size_t) override
+			{
+				auto const lock = std::lock_guard(mutex);
+				openResolutions[std::this_thread::get_id()].push_back(key);
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds, bool) override
+			{
+				auto const lock = std::lock_guard(mutex);
+				auto& open = openResolutions[std::this_thread::get_id()];
+
+				++endCount;
+				if (open.empty() || !(open.back() == key))
+				{
+					++unbalancedEndCount;
+					return;
+				}
+
+				open.pop_back();
+			}
+
+			[[nodiscard]] int GetEndCount()
+			{
+				auto const lock = std::lock_guard(mutex);
+				return endCount;
+			}
+
+			[[nodiscard]] int GetUnbalancedEndCount()
+			{
+				auto const lock = std::lock_guard(mutex);
+				return unbalancedEndCount;
+			}
+
+			[[nodiscard]] bool HasOpenResolutions()
+			{
+				auto const lock = std::lock_guard(mutex);
+				for (auto const& [thread, open] : openResolutions)
+				{
+					if (!open.empty())
+					{
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+		private:
+			std::mutex mutex{};
+			std::map<std::thread::id, std::vector<Bindings::BindingKey>> openResolutions{};
+			int endCount = 0;
+			int unbalancedEndCount = 0;
+	};
+#endif
+
+	Internal::DetachedTask StoreResult(Async::Task<std::string> task, std::optional<std::string>& result)
+	{
+		result = co_await std::move(task);
+	}
+
+	TEST_CASE("AsyncSerumResolver_GetAsync")
+	{
+		auto container = SerumContainer();
+		container.BindConstant<std::string>(std::string("Serum"), "name")
+				 .BindAsyncResolver<std::string, GreetingResolver>();
+
+		SECTION("WhenBindingIsAsync_AwaitsDependencies")
+		{
+			REQUIRE("Hello Serum" == Async::SyncWait(container.GetAsync<std::string>()));
+		}
+
+		SECTION("WhenBindingIsNotAsync_ResolvesBinding")
+		{
+			REQUIRE("Serum" == Async::SyncWait(container.GetAsync<std::string>("name")));
+		}
+
+		SECTION("WhenBindingDoesNotExist_Throws")
+		{
+			REQUIRE_THROWS_AS(Async::SyncWait(container.GetAsync<int>()), SerumException);
+		}
+
+		SECTION("WhenResolvedSynchronously_ReturnsResult")
+		{
+			REQUIRE("Hello Serum" == container.Get<std::string>());
+		}
+	}
+
+	TEST_CASE("AsyncSerumResolver_WhenResolverThrows_ExceptionIsPropagated")
+	{
+		auto container = SerumContainer();
+		container.BindAsyncResolver<int, ThrowingResolver>();
+
+		REQUIRE_THROWS_AS(Async::SyncWait(container.GetAsync<int>()), SerumException);
+		REQUIRE_THROWS_AS(container.Get<int>(), SerumException);
+	}
+
+	TEST_CASE("AsyncSerumResolver_Executors")
+	{
+		SECTION("WhenContainerHasExecutor_ResolverIsResumedOnExecutor")
+		{
+			auto const executor = std::make_shared<QueueExecutor>();
+			auto container = SerumContainer();
+			container.BindConstant<std::string>(std::string("Serum"), "name")
+					 .BindAsyncResolver<std::string, GreetingResolver>()
+					 .SetExecutor(executor);
+			auto result = std::optional<std::string>();
+
+			StoreResult(container.GetAsync<std::string>(), result);
+			CHECK_FALSE(result.has_value());
+
+			executor->RunAll();
+			REQUIRE(result == "Hello Serum");
+		}
+
+		SECTION("WhenBindingHasExecutor_ResolverIsResumedOnBindingExecutor")
+		{
+			auto const containerExecutor = std::make_shared<QueueExecutor>();
+			auto const bindingExecutor = std::make_shared<QueueExecutor>();
+			auto container = SerumContainer();
+			container.BindConstant<std::string>(std::string("Serum"), "name")
+					 .BindAsyncResolver<std::string, GreetingResolver>("", bindingExecutor)
+					 .SetExecutor(containerExecutor);
+			auto result = std::optional<std::string>();
+
+			StoreResult(container.GetAsync<std::string>(), result);
+			containerExecutor->RunAll();
+			CHECK_FALSE(result.has_value());
+
+			bindingExecutor->RunAll();
+			REQUIRE(result == "Hello Serum");
+		}
+
+		SECTION("WhenExecutorIsThreadPool_ManyResolutionsShareThreads")
+		{
+			constexpr auto numberOfResolutions = 256;
+			auto const executor = std::make_shared<Async::ThreadPoolExecutor>(2);
+			auto container = SerumContainer();
+			container.BindConstant<std::string>(std::string("Serum"), "name")
+					 .BindAsyncResolver<std::string, GreetingResolver>()
+					 .SetExecutor(executor);
+
+			auto tasks = std::vector<Async::Task<std::string>>();
+			for (auto i = 0; i < numberOfResolutions; ++i)
+			{
+				tasks.push_back(container.GetAsync<std::string>());
+			}
+
+			auto resolved = 0;
+			for (auto& task : tasks)
+			{
+				resolved += Async::SyncWait(std::move(task)) == "Hello Serum" ? 1 : 0;
+			}
+
+			REQUIRE(numberOfResolutions == resolved);
+		}
+	}
+
+#ifdef SERUM_HAS_OBSERVERS
+	TEST_CASE("AsyncSerumResolver_WhenResumedOnThreadPool_ReportsEachResolutionOnOneThread")
+	{
+		constexpr auto numberOfResolutions = 64;
+		auto const observer = std::make_shared<ThreadBalanceObserver>();
+		auto container = SerumContainer();
+		container.BindAsyncResolver<std::string, NameResolver>("name")
+				 .BindAsyncResolver<std::string, GreetingResolver>()
+				 .SetExecutor(std::make_shared<Async::ThreadPoolExecutor>(4))
+				 .SetObserver(observer);
+
+		for (auto i = 0; i < numberOfResolutions; ++i)
+		{
+			REQUIRE("Hello Serum" == Async::SyncWait(container.GetAsync<std::string>()));
+		}
+
+		REQUIRE(2 * numberOfResolutions == observer->GetEndCount());
+		REQUIRE(0 == observer->GetUnbalancedEndCount());
+		REQUIRE_FALSE(observer->HasOpenResolutions());
+
+#ifdef SERUM_ENABLE_METRICS
+		for (auto const& statistics : container.GetStatistics())
+		{
+			REQUIRE(numberOfResolutions == statistics.resolveCount);
+			REQUIRE(0 == statistics.failureCount);
+		}
+#endif
+	}
+#endif
+
+#if SERUM_RESOLUTION_TRACKING == SERUM_RESOLUTION_TRACKING_FULL
+	TEST_CASE("AsyncSerumResolver_ResolutionPathIncludesAsyncBinding")
+	{
+		auto container = SerumContainer();
+		auto wasRequestedByAsyncBinding = false;
+		container.BindFunction<std::string>([&](ResolutionContext& context)
+				 {
+					 wasRequestedByAsyncBinding = context.ResolutionPathContainsType(typeid(std::string));
+					 return std::string("Serum");
+				 }, "name")
+				 .BindAsyncResolver<std::string, GreetingResolver>();
+
+		Async::SyncWait(container.GetAsync<std::string>());
+
+		REQUIRE(wasRequestedByAsyncBinding);
+	}
+#endif
+}
+
+#endif // SERUM_HAS_COROUTINES
@@ -0,0 +1,47 @@
+/// @file ConstantBindingTests.cpp
+/// Unit tests for the ConstantBinding type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum.Tests/CopyCountingType.hpp"
+
+namespace Serum::Bindings::ConstantBindingTests
+{
+	TEST_CASE("ConstantBinding_ConstructorCorrectlyIntializesMembers")
+	{
+		std::string const name = "Test Name";
+
+		auto binding = ConstantBinding<int>(3, name);
+
+		REQUIRE(binding.GetBindingKey() == BindingKey(typeid(int), name));
+		REQUIRE(binding.GetBindingType() == BindingType::Constant);
+	}
+
+	TEST_CASE("ConstantBinding_Resolve")
+	{
+		auto binding = ConstantBinding<CopyCountingType>(CopyCountingType(4));
+		auto context = ResolutionContext();
+		CopyCountingType::numberOfCopies = 0;
+
+		SECTION("GetReference_DoesNotCopy")
+		{
+			REQUIRE(4 == binding.GetReference().value);
+			REQUIRE(&binding.GetReference() == &binding.GetReference());
+			REQUIRE(0 == CopyCountingType::numberOfCopies);
+		}
+
+		SECTION("Resolve_ReturnsCopy")
+		{
+			REQUIRE(4 == binding.Resolve(context).value);
+			REQUIRE(1 == CopyCountingType::numberOfCopies);
+		}
+
+		SECTION("Clone_SharesValue")
+		{
+			auto const clone = std::static_pointer_cast<ConstantBinding<CopyCountingType>>(binding.Clone());
+
+			REQUIRE(&binding.GetReference() == &clone->GetReference());
+			REQUIRE(0 == CopyCountingType::numberOfCopies);
+		}
+	}
+}
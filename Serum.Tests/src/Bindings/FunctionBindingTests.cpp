@@ -27,4 +27,26 @@ namespace Serum::Bindings::FunctionBindingTests
 
 		REQUIRE(testValue == result);
 	}
+
+	TEST_CASE("FunctionBinding_MakeFunctionBinding_StoresConcreteFunctionType")
+	{
+		auto const function = [](ResolutionContext&) { return 3; };
+		auto binding = MakeFunctionBinding<int>(function, "name");
+		auto context = ResolutionContext();
+
+		STATIC_REQUIRE(std::is_same<FunctionBinding<int, std::decay_t<decltype(function)>>, decltype(binding)>::value);
+		REQUIRE(binding.GetBindingKey() == BindingKey(typeid(int), "name"));
+		REQUIRE(3 == binding.Resolve(context));
+	}
+
+	TEST_CASE("FunctionBinding_Clone_ResolvesCorrectly")
+	{
+		auto binding = MakeFunctionBinding<int>([](ResolutionContext&) { return 3; });
+		auto context = ResolutionContext();
+
+		auto const clone = binding.Clone();
+
+		REQUIRE(binding.GetBindingId() == clone->GetBindingId());
+		REQUIRE(3 == clone->Resolve(context));
+	}
 }
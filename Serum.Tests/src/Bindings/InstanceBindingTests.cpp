@@ -0,0 +1,52 @@
+/// @file InstanceBindingTests.cpp
+/// Unit tests for the InstanceBinding type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum.Tests/CopyCountingType.hpp"
+
+namespace Serum::Bindings::InstanceBindingTests
+{
+	TEST_CASE("InstanceBinding_ConstructorCorrectlyIntializesMembers")
+	{
+		std::string const name = "Test Name";
+		auto instance = 3;
+
+		auto binding = InstanceBinding<int>(instance, name);
+
+		REQUIRE(binding.GetBindingKey() == BindingKey(typeid(int), name));
+		REQUIRE(binding.GetBindingType() == BindingType::Instance);
+	}
+
+	TEST_CASE("InstanceBinding_Resolve")
+	{
+		auto instance = CopyCountingType(4);
+		CopyCountingType::numberOfCopies = 0;
+		auto binding = InstanceBinding<CopyCountingType>(instance);
+		auto context = ResolutionContext();
+
+		SECTION("GetReference_ReturnsInstance")
+		{
+			REQUIRE(&instance == &binding.GetReference());
+			REQUIRE(0 == CopyCountingType::numberOfCopies);
+		}
+
+		SECTION("Resolve_ReturnsCopyOfCurrentValue")
+		{
+			instance.value = 5;
+
+			REQUIRE(5 == binding.Resolve(context).value);
+			REQUIRE(1 == CopyCountingType::numberOfCopies);
+		}
+	}
+
+	TEST_CASE("InstanceBinding_WhenTypeIsNotCopyConstructible_ResolveThrows")
+	{
+		auto instance = std::mutex();
+		auto binding = InstanceBinding<std::mutex>(instance);
+		auto context = ResolutionContext();
+
+		REQUIRE(&instance == &binding.GetReference());
+		REQUIRE_THROWS_AS(binding.Resolve(context), SerumException);
+	}
+}
@@ -0,0 +1,115 @@
+/// @file DependencyGraphTests.cpp
+/// Unit tests for the DependencyGraph type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+namespace Serum::DependencyGraphTests
+{
+	TEST_CASE("DependencyGraph_Constructor")
+	{
+		SECTION("OrdersNodesAndEdgesByKey")
+		{
+			auto const first = Bindings::BindingKey(typeid(int), "a");
+			auto const second = Bindings::BindingKey(typeid(int), "b");
+			auto const graph = DependencyGraph(
+				{
+					DependencyGraphNode{ second, Bindings::BindingType::Function, Bindings::BindingLifetime::Transient },
+					DependencyGraphNode{ first, Bindings::BindingType::Function, Bindings::BindingLifetime::Transient }
+				},
+				{
+					DependencyGraphEdge{ second, first, 1, std::chrono::nanoseconds(1) },
+					DependencyGraphEdge{ first, second, 1, std::chrono::nanoseconds(1) }
+				});
+
+			REQUIRE(first == graph.GetNodes()[0].key);
+			REQUIRE(second == graph.GetNodes()[1].key);
+			REQUIRE(first == graph.GetEdges()[0].dependent);
+			REQUIRE(second == graph.GetEdges()[1].dependent);
+		}
+	}
+
+	TEST_CASE("DependencyGraph_ToString")
+	{
+		auto const dependent = Bindings::BindingKey(typeid(double), "");
+		auto const dependency = Bindings::BindingKey(typeid(int), "na\"me");
+		auto const graph = DependencyGraph(
+			{
+				DependencyGraphNode{ dependent, Bindings::BindingType::Function, Bindings::BindingLifetime::Transient },
+				DependencyGraphNode{ dependency, Bindings::BindingType::Singleton, Bindings::BindingLifetime::Singleton }
+			},
+			{
+				DependencyGraphEdge{ dependent, dependency, 3, std::chrono::nanoseconds(1500) }
+			});
+
+		SECTION("WhenFormatIsDot_WritesDigraph")
+		{
+			auto const dot = graph.ToString(GraphFormat::Dot);
+
+			REQUIRE(0 == dot.find("digraph Serum {"));
+			REQUIRE(std::string::npos != dot.find("Singleton, Singleton"));
+			REQUIRE(std::string::npos != dot.find("na\\\"me"));
+			REQUIRE(std::string::npos != dot.find(" -> "));
+			REQUIRE(std::string::npos != dot.find("3 x 1.500us"));
+		}
+
+		SECTION("WhenFormatIsJson_WritesNodesAndEdges")
+		{
+			auto const json = graph.ToString(GraphFormat::Json);
+
+			REQUIRE(0 == json.find("{\"nodes\":["));
+			REQUIRE(std::string::npos != json.find("\"bindingType\":\"Singleton\",\"lifetime\":\"Singleton\""));
+			REQUIRE(std::string::npos != json.find("\"name\":\"na\\\"me\""));
+			REQUIRE(std::string::npos != json.find("\"resolveCount\":3,\"totalNanoseconds\":1500"));
+		}
+	}
+
+	TEST_CASE("BindingLifetime_GetBindingLifetime")
+	{
+		SECTION("MapsBindingTypesToLifetimes")
+		{
+			REQUIRE(Bindings::BindingLifetime::Transient == Bindings::GetBindingLifetime(Bindings::BindingType::Function));
+			REQUIRE(Bindings::BindingLifetime::Transient == Bindings::GetBindingLifetime(Bindings::BindingType::Resolver));
+			REQUIRE(Bindings::BindingLifetime::Singleton == Bindings::GetBindingLifetime(Bindings::BindingType::Singleton));
+			REQUIRE(Bindings::BindingLifetime::Singleton == Bindings::GetBindingLifetime(Bindings::BindingType::Constant));
+			REQUIRE(Bindings::BindingLifetime::PerResolution == Bindings::GetBindingLifetime(Bindings::BindingType::PerResolution));
+			REQUIRE(Bindings::BindingLifetime::External == Bindings::GetBindingLifetime(Bindings::BindingType::Instance));
+		}
+	}
+
+	TEST_CASE("SerumContainer_ExportDependencyGraph")
+	{
+		SECTION("WhenNothingIsObserved_ExportsEveryBinding")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([](ResolutionContext&) { return 1.0; });
+
+			auto const graph = container.GetDependencyGraph();
+
+			REQUIRE(2 == graph.GetNodes().size());
+			REQUIRE(graph.GetEdges().empty());
+			REQUIRE(graph.ToString(GraphFormat::Json) == container.ExportDependencyGraph(GraphFormat::Json));
+		}
+
+#ifdef SERUM_HAS_OBSERVERS
+		SECTION("WhenObserverIsRecorder_ExportsObservedDependencies")
+		{
+			auto recorder = std::make_shared<Observers::DependencyGraphRecorder>();
+			auto container = SerumContainer();
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 })
+					 .SetObserver(recorder);
+
+			(void)container.Get<double>();
+
+			REQUIRE(1 == container.GetDependencyGraph().GetEdges().size());
+			REQUIRE(1 == container.GetDependencyGraph(*recorder).GetEdges().size());
+			REQUIRE(std::string::npos != container.ExportDependencyGraph(GraphFormat::Dot).find(" -> "));
+		}
+#endif
+	}
+}
@@ -0,0 +1,46 @@
+/// @file ExplicitInstantiationTests.cpp
+/// Unit tests for explicitly instantiating SerumContainer::Get.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+namespace Serum::ExplicitInstantiationTests
+{
+	struct Service final
+	{
+		int value = 0;
+	};
+}
+
+SERUM_EXTERN_GET(Serum::ExplicitInstantiationTests::Service);
+SERUM_EXTERN_GET(std::pair<int, int>);
+
+namespace Serum::ExplicitInstantiationTests
+{
+	TEST_CASE("SerumContainer_ExplicitInstantiation")
+	{
+		auto container = SerumContainer();
+		container.BindFunction<Service>([](auto&) { return Service{ 42 }; })
+				 .BindConstant<std::pair<int, int>>(std::make_pair(1, 2));
+
+		SECTION("WhenGetIsDeclaredExtern_ResolvesService")
+		{
+			REQUIRE(42 == container.Get<Service>().value);
+		}
+
+		SECTION("WhenGetIsDeclaredExtern_ResolvesServiceWithContext")
+		{
+			auto context = ResolutionContext();
+
+			REQUIRE(42 == container.Get<Service>(context).value);
+		}
+
+		SECTION("WhenTypeContainsCommas_ResolvesService")
+		{
+			REQUIRE(std::make_pair(1, 2) == container.Get<std::pair<int, int>>());
+		}
+	}
+}
+
+SERUM_INSTANTIATE_GET(Serum::ExplicitInstantiationTests::Service);
+SERUM_INSTANTIATE_GET(std::pair<int, int>);
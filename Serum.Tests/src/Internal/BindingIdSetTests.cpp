@@ -0,0 +1,49 @@
+/// @file BindingIdSetTests.cpp
+/// Unit tests for the BindingIdSet type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+namespace Serum::Internal::BindingIdSetTests
+{
+	TEST_CASE("BindingIdSet_Insert")
+	{
+		auto set = BindingIdSet();
+
+		SECTION("WhenIdIsNew_ReturnsTrue")
+		{
+			REQUIRE(set.Insert(1));
+			REQUIRE(set.Contains(1));
+		}
+
+		SECTION("WhenIdIsPresent_ReturnsFalse")
+		{
+			set.Insert(1);
+
+			REQUIRE_FALSE(set.Insert(1));
+			REQUIRE(1 == set.Size());
+		}
+	}
+
+	TEST_CASE("BindingIdSet_WhenGrownAndErased_KeepsRemainingIds")
+	{
+		constexpr auto numberOfIds = BindingId(200);
+		auto set = BindingIdSet();
+
+		for (auto id = BindingId(1); id <= numberOfIds; ++id)
+		{
+			REQUIRE(set.Insert(id));
+		}
+
+		for (auto id = BindingId(1); id <= numberOfIds; id += 2)
+		{
+			set.Erase(id);
+		}
+
+		REQUIRE(numberOfIds / 2 == set.Size());
+		for (auto id = BindingId(1); id <= numberOfIds; ++id)
+		{
+			REQUIRE(set.Contains(id) == (id % 2 == 0));
+		}
+	}
+}
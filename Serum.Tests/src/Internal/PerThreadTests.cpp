@@ -0,0 +1,92 @@
+/// @file PerThreadTests.cpp
+/// Unit tests for the PerThread type.
+
+#include "catch.hpp"
+#include "Serum/Internal/PerThread.hpp"
+
+#include <set>
+
+namespace Serum::Internal::PerThreadTests
+{
+	TEST_CASE("PerThread_GetLocal")
+	{
+		auto perThread = PerThread<int>();
+
+		SECTION("WhenCalledTwiceOnOneThread_ReturnsSameSlot")
+		{
+			auto& first = perThread.GetLocal();
+			auto& second = perThread.GetLocal();
+
+			REQUIRE(&first == &second);
+			REQUIRE(1 == first.threadIndex);
+			REQUIRE(1 == perThread.GetNumberOfThreads());
+		}
+
+		SECTION("WhenCalledOnSeveralThreads_ReturnsSlotPerThread")
+		{
+			perThread.GetLocal().state = 1;
+			auto thread = std::thread([&perThread] { perThread.GetLocal().state = 2; });
+			thread.join();
+
+			auto sum = 0;
+			perThread.ForEach([&sum](auto const& slot) { sum += slot.state; });
+
+			REQUIRE(2 == perThread.GetNumberOfThreads());
+			REQUIRE(3 == sum);
+		}
+
+		SECTION("WhenInstancesAreUsedTogether_KeepsSlotsSeparate")
+		{
+			auto other = PerThread<int>();
+
+			for (auto i = 0; i < 3; ++i)
+			{
+				++perThread.GetLocal().state;
+				other.GetLocal().state += 10;
+			}
+
+			REQUIRE(3 == perThread.GetLocal().state);
+			REQUIRE(30 == other.GetLocal().state);
+			REQUIRE(1 == other.GetNumberOfThreads());
+		}
+
+		SECTION("WhenManyInstancesAreAlive_GivesEachADistinctIndex")
+		{
+			auto instances = std::vector<std::unique_ptr<PerThread<int>>>();
+			for (auto i = 0; i < 32; ++i)
+			{
+				instances.push_back(std::make_unique<PerThread<int>>());
+			}
+
+			for (auto i = 0; i < 3; ++i)
+			{
+				for (auto const& instance : instances)
+				{
+					++instance->GetLocal().state;
+				}
+			}
+
+			auto indices = std::set<std::size_t>({ perThread.GetIndex() });
+			for (auto const& instance : instances)
+			{
+				indices.insert(instance->GetIndex());
+				REQUIRE(3 == instance->GetLocal().state);
+			}
+
+			REQUIRE(instances.size() + 1 == indices.size());
+		}
+
+		SECTION("WhenIndexIsReused_ReturnsNewSlot")
+		{
+			auto first = std::make_unique<PerThread<int>>();
+			auto const index = first->GetIndex();
+			first->GetLocal().state = 5;
+			first.reset();
+
+			auto second = PerThread<int>();
+
+			REQUIRE(index == second.GetIndex());
+			REQUIRE(0 == second.GetLocal().state);
+		}
+	}
+}
@@ -0,0 +1,75 @@
+/// @file SmallVectorTests.cpp
+/// Unit tests for the SmallVector type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum/Internal/SmallVector.hpp"
+
+namespace Serum::Internal::SmallVectorTests
+{
+	TEST_CASE("SmallVector_EmplaceBack")
+	{
+		auto vector = SmallVector<std::string, 2>();
+
+		SECTION("WhenWithinInlineCapacity_StoresInline")
+		{
+			vector.EmplaceBack("a");
+			vector.EmplaceBack("b");
+
+			REQUIRE(2 == vector.Size());
+			REQUIRE_FALSE(vector.IsOnHeap());
+			REQUIRE("b" == vector.Back());
+		}
+
+		SECTION("WhenInlineCapacityIsExceeded_SpillsToHeapAndKeepsElements")
+		{
+			vector.EmplaceBack("a");
+			vector.EmplaceBack("b");
+			vector.EmplaceBack("c");
+
+			REQUIRE(3 == vector.Size());
+			REQUIRE(vector.IsOnHeap());
+			REQUIRE("a" == vector[0]);
+			REQUIRE("b" == vector[1]);
+			REQUIRE("c" == vector[2]);
+		}
+	}
+
+	TEST_CASE("SmallVector_PopBack_RemovesLastElement")
+	{
+		auto vector = SmallVector<int, 4>();
+		vector.EmplaceBack(1);
+		vector.EmplaceBack(2);
+
+		vector.PopBack();
+
+		REQUIRE(1 == vector.Size());
+		REQUIRE(1 == vector.Back());
+	}
+
+	TEST_CASE("SmallVector_CopyAndMove")
+	{
+		auto vector = SmallVector<std::string, 2>();
+		vector.EmplaceBack("a");
+		vector.EmplaceBack("b");
+		vector.EmplaceBack("c");
+
+		SECTION("Copy_CopiesElements")
+		{
+			auto const copy = vector;
+
+			REQUIRE(3 == copy.Size());
+			REQUIRE("c" == copy[2]);
+			REQUIRE(3 == vector.Size());
+		}
+
+		SECTION("Move_TransfersElements")
+		{
+			auto const moved = std::move(vector);
+
+			REQUIRE(3 == moved.Size());
+			REQUIRE("a" == moved[0]);
+			REQUIRE(vector.Empty());
+		}
+	}
+}
@@ -0,0 +1,395 @@
+/// @file TracepointsTests.cpp
+/// Unit tests for the static tracepoints.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_TRACEPOINTS
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include <elf.h>
+#include <link.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace Serum::Internal::TracepointsTests
+{
+	struct Service final
+	{
+		using SerumDependencies = Dependencies<int>;
+
+		explicit Service(int)
+		{
+		}
+	};
+
+	/// Where a tracepoint reads one of its arguments from.
+	struct ProbeArgument final
+	{
+		std::string registerName;
+		long offset = 0;
+		bool isMemory = false;
+		bool isImmediate = false;
+	};
+
+	/// A tracepoint described by an ELF note of the running executable.
+	struct Probe final
+	{
+		std::string provider;
+		std::string name;
+		std::uintptr_t address;
+		std::vector<ProbeArgument> arguments;
+	};
+
+	/// Parses an argument description of the form "8@%rax", "8@-16(%rbp)" or "-4@$1".
+	ProbeArgument ParseArgument(std::string const& description)
+	{
+		auto argument = ProbeArgument();
+		auto location = description.substr(description.find('@') + 1);
+
+		if (location[0] == '$')
+		{
+			argument.isImmediate = true;
+			argument.offset = std::stol(location.substr(1));
+		}
+		else if (location[0] == '%')
+		{
+			argument.registerName = location.substr(1);
+		}
+		else
+		{
+			auto const open = location.find('(');
+			argument.isMemory = true;
+			argument.offset = open == 0 ? 0 : std::stol(location.substr(0, open));
+			argument.registerName = location.substr(open + 2, location.find(')') - open - 2);
+		}
+
+		return argument;
+	}
+
+	/// Reads the stapsdt notes of the running executable, as a tracer does.
+	std::vector<Probe> ReadProbes()
+	{
+		auto file = std::ifstream("/proc/self/exe", std::ios::binary);
+		auto const image = std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+		auto header = Elf64_Ehdr();
+		std::memcpy(&header, image.data(), sizeof(header));
+
+		auto const getSection = [&image, &header](std::size_t const index)
+		{
+			auto section = Elf64_Shdr();
+			std::memcpy(&section, image.data() + header.e_shoff + index * header.e_shentsize, sizeof(section));
+
+			return section;
+		};
+
+		auto const sectionNames = getSection(header.e_shstrndx);
+
+		// The executable is position independent, so its notes hold addresses relative to where it is loaded.
+		auto loadAddress = std::uintptr_t(0);
+		dl_iterate_phdr([](dl_phdr_info* info, std::size_t, void* data)
+		{
+			*static_cast<std::uintptr_t*>(data) = info->dlpi_addr;
+			return 1;
+		}, &loadAddress);
+
+		auto probes = std::vector<Probe>();
+
+		for (auto index = std::size_t(0); index < header.e_shnum; ++index)
+		{
+			auto const section = getSection(index);
+			if (std::string(image.data() + sectionNames.sh_offset + section.sh_name) != ".note.stapsdt")
+			{
+				continue;
+			}
+
+			for (auto offset = section.sh_offset; offset < section.sh_offset + section.sh_size;)
+			{
+				auto note = Elf64_Nhdr();
+				std::memcpy(&note, image.data() + offset, sizeof(note));
+
+				auto const* const description = image.data() + offset + sizeof(note) + ((note.n_namesz + 3) & ~3u);
+				auto address = std::uint64_t(0);
+				std::memcpy(&address, description, sizeof(address));
+
+				auto const* const provider = description + 3 * sizeof(std::uint64_t);
+				auto const* const name = provider + std::strlen(provider) + 1;
+				auto const* const arguments = name + std::strlen(name) + 1;
+
+				auto probe = Probe{ provider, name, loadAddress + address, {} };
+				auto stream = std::istringstream(arguments);
+				for (auto argument = std::string(); stream >> argument;)
+				{
+					probe.arguments.push_back(ParseArgument(argument));
+				}
+
+				probes.push_back(std::move(probe));
+				offset += sizeof(note) + ((note.n_namesz + 3) & ~3u) + ((note.n_descsz + 3) & ~3u);
+			}
+		}
+
+		return probes;
+	}
+
+#ifdef __x86_64__
+	/// A tracepoint firing recorded by a ProbeTracer.
+	struct ProbeHit final
+	{
+		std::size_t probe;
+		std::array<char, 128> typeName;
+		std::array<char, 128> bindingName;
+	};
+
+	/// Attaches to every "serum" tracepoint the way a tracer does: by replacing its nop with a breakpoint,
+	/// and reading its arguments from the registers when the breakpoint traps.
+	class ProbeTracer final
+	{
+		public:
+			ProbeTracer()
+				: probes(ReadProbes())
+			{
+				probes.erase(
+					std::remove_if(probes.begin(), probes.end(), [](auto const& probe) { return probe.provider != "serum"; }),
+					probes.end());
+
+				struct sigaction action{};
+				action.sa_sigaction = &ProbeTracer::OnTrap;
+				action.sa_flags = SA_SIGINFO;
+				sigemptyset(&action.sa_mask);
+				sigaction(SIGTRAP, &action, &previousAction);
+
+				activeTracer = this;
+				isAttached = std::all_of(probes.begin(), probes.end(), [](auto const& probe) { return Patch(probe.address, 0x90, 0xCC); });
+			}
+
+			ProbeTracer(ProbeTracer const&) = delete;
+
+			~ProbeTracer()
+			{
+				for (auto const& probe : probes)
+				{
+					Patch(probe.address, 0xCC, 0x90);
+				}
+
+				activeTracer = nullptr;
+				sigaction(SIGTRAP, &previousAction, nullptr);
+			}
+
+			ProbeTracer& operator=(ProbeTracer const&) = delete;
+
+			/// Gets whether every tracepoint could be patched. Systems which forbid writable code cannot be traced this way.
+			[[nodiscard]] bool IsAttached() const noexcept
+			{
+				return isAttached;
+			}
+
+			/// Gets the tracepoints which fired, in order, as "name(type, binding name)".
+			[[nodiscard]] std::vector<std::string> GetHits() const
+			{
+				auto hits = std::vector<std::string>();
+				for (auto index = std::size_t(0); index < hitCount; ++index)
+				{
+					hits.push_back(
+						probes[this->hits[index].probe].name + "(" + this->hits[index].typeName.data() + ", "
+						+ this->hits[index].bindingName.data() + ")");
+				}
+
+				return hits;
+			}
+
+		private:
+			static inline ProbeTracer* activeTracer = nullptr;
+
+			std::vector<Probe> probes;
+			std::array<ProbeHit, 64> hits{};
+			std::size_t hitCount = 0;
+			bool isAttached = false;
+			struct sigaction previousAction{};
+
+			static bool Patch(std::uintptr_t const address, unsigned char const expected, unsigned char const replacement)
+			{
+				auto const pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+				auto* const page = reinterpret_cast<void*>(address & ~(pageSize - 1));
+				auto* const instruction = reinterpret_cast<unsigned char*>(address);
+
+				if (*instruction != expected || mprotect(page, pageSize, PROT_READ | PROT_WRITE | PROT_EXEC) != 0)
+				{
+					return false;
+				}
+
+				*instruction = replacement;
+				__builtin___clear_cache(reinterpret_cast<char*>(instruction), reinterpret_cast<char*>(instruction + 1));
+
+				return mprotect(page, pageSize, PROT_READ | PROT_EXEC) == 0;
+			}
+
+			static void OnTrap(int, siginfo_t*, void* context)
+			{
+				auto* const tracer = activeTracer;
+				auto const& registers = static_cast<ucontext_t*>(context)->uc_mcontext.gregs;
+
+				// The breakpoint has executed, so the instruction pointer is already past it, where the nop would have been.
+				auto const address = static_cast<std::uintptr_t>(registers[REG_RIP]) - 1;
+
+				for (auto index = std::size_t(0); tracer != nullptr && index < tracer->probes.size(); ++index)
+				{
+					auto const& probe = tracer->probes[index];
+					if (probe.address != address || tracer->hitCount == tracer->hits.size())
+					{
+						continue;
+					}
+
+					auto& hit = tracer->hits[tracer->hitCount++];
+					hit.probe = index;
+					CopyString(ReadArgument(probe.arguments[0], registers), hit.typeName);
+					CopyString(ReadArgument(probe.arguments[1], registers), hit.bindingName);
+				}
+			}
+
+			static char const* ReadArgument(ProbeArgument const& argument, gregset_t const& registers)
+			{
+				static constexpr std::pair<char const*, int> registerIndices[] = {
+					{ "rax", REG_RAX }, { "rbx", REG_RBX }, { "rcx", REG_RCX }, { "rdx", REG_RDX },
+					{ "rsi", REG_RSI }, { "rdi", REG_RDI }, { "rbp", REG_RBP }, { "rsp", REG_RSP },
+					{ "r8", REG_R8 }, { "r9", REG_R9 }, { "r10", REG_R10 }, { "r11", REG_R11 },
+					{ "r12", REG_R12 }, { "r13", REG_R13 }, { "r14", REG_R14 }, { "r15", REG_R15 }
+				};
+
+				if (argument.isImmediate)
+				{
+					return reinterpret_cast<char const*>(argument.offset);
+				}
+
+				auto value = std::uintptr_t(0);
+				for (auto const& [name, index] : registerIndices)
+				{
+					if (argument.registerName == name)
+					{
+						value = static_cast<std::uintptr_t>(registers[index]);
+					}
+				}
+
+				if (argument.isMemory)
+				{
+					std::memcpy(&value, reinterpret_cast<void const*>(value + argument.offset), sizeof(value));
+				}
+
+				return reinterpret_cast<char const*>(value);
+			}
+
+			static void CopyString(char const* const source, std::array<char, 128>& destination)
+			{
+				auto length = std::size_t(0);
+				for (; source != nullptr && source[length] != '\0' && length + 1 < destination.size(); ++length)
+				{
+					destination[length] = source[length];
+				}
+
+				destination[length] = '\0';
+			}
+	};
+#endif
+
+	TEST_CASE("Tracepoints_Notes")
+	{
+		SECTION("DescribesEachTracepointWithTwoArguments")
+		{
+			auto const probes = ReadProbes();
+
+			for (auto const* const name : { "get_begin", "get_end", "resolve_begin", "resolve_end", "singleton_begin", "singleton_end" })
+			{
+				auto const probe = std::find_if(probes.begin(), probes.end(), [name](auto const& candidate)
+				{
+					return candidate.provider == "serum" && candidate.name == name;
+				});
+
+				REQUIRE(probe != probes.end());
+				REQUIRE(2 == probe->arguments.size());
+			}
+		}
+	}
+
+#ifdef __x86_64__
+	TEST_CASE("Tracepoints_Fire")
+	{
+		auto const intType = std::string(typeid(int).name());
+		auto const serviceType = std::string(typeid(std::shared_ptr<Service>).name());
+		auto container = SerumContainer();
+
+		SECTION("WhenBindingIsResolved_FiresGetAndResolveWithKey")
+		{
+			container.BindConstant<int>(1, "answer");
+
+			auto tracer = ProbeTracer();
+			if (!tracer.IsAttached())
+			{
+				WARN("Code cannot be patched on this system, so the tracepoints cannot be traced.");
+				return;
+			}
+
+			(void)container.Get<int>("answer");
+
+			REQUIRE(std::vector<std::string>{
+				"get_begin(" + intType + ", answer)",
+				"resolve_begin(" + intType + ", answer)",
+				"resolve_end(" + intType + ", answer)",
+				"get_end(" + intType + ", answer)"
+			} == tracer.GetHits());
+		}
+
+		SECTION("WhenSingletonIsConstructed_FiresSingletonOnce")
+		{
+			container.BindConstant<int>(1)
+					 .BindSingletonSharedPointer<Service>();
+
+			auto tracer = ProbeTracer();
+			if (!tracer.IsAttached())
+			{
+				WARN("Code cannot be patched on this system, so the tracepoints cannot be traced.");
+				return;
+			}
+
+			(void)container.Get<std::shared_ptr<Service>>();
+			(void)container.Get<std::shared_ptr<Service>>();
+
+			auto const hits = tracer.GetHits();
+
+			REQUIRE(1 == std::count(hits.begin(), hits.end(), "singleton_begin(" + serviceType + ", )"));
+			REQUIRE(1 == std::count(hits.begin(), hits.end(), "singleton_end(" + serviceType + ", )"));
+			REQUIRE(1 == std::count(hits.begin(), hits.end(), "resolve_begin(" + intType + ", )"));
+			REQUIRE(2 == std::count(hits.begin(), hits.end(), "get_end(" + serviceType + ", )"));
+		}
+
+		SECTION("WhenResolutionThrows_FiresEndTracepoints")
+		{
+			container.BindFunction<int>([](ResolutionContext&) -> int { throw SerumException("Failed."); });
+
+			auto tracer = ProbeTracer();
+			if (!tracer.IsAttached())
+			{
+				WARN("Code cannot be patched on this system, so the tracepoints cannot be traced.");
+				return;
+			}
+
+			REQUIRE_THROWS_AS(container.Get<int>(), SerumException);
+
+			auto const hits = tracer.GetHits();
+
+			REQUIRE(4 == hits.size());
+			REQUIRE("resolve_end(" + intType + ", )" == hits[2]);
+			REQUIRE("get_end(" + intType + ", )" == hits[3]);
+		}
+	}
+#endif
+}
+
+#endif // SERUM_HAS_TRACEPOINTS
@@ -16,6 +16,21 @@ namespace Serum::Internal::TypeTraitsTests
 
 	struct WithoutSerumConstructor final {};
 
+	struct WithSerumDependencies final
+	{
+		using SerumDependencies = Dependencies<int, std::string>;
+	};
+
+	struct WithSerumConstructorAndDependencies final
+	{
+		using SerumDependencies = Dependencies<int, std::string>;
+
+		static WithSerumConstructorAndDependencies* SerumConstructor(SerumContainer&, ResolutionContext&)
+		{
+			return new WithSerumConstructorAndDependencies();
+		}
+	};
+
 	TEST_CASE("TypeTraits_HasSerumConstructor")
 	{
 		SECTION("WhenTypeHasSerumConstructor_ValueIsTrue")
@@ -28,4 +43,32 @@ namespace Serum::Internal::TypeTraitsTests
 			REQUIRE_FALSE(HasSerumConstructor<WithoutSerumConstructor>::value);
 		}
 	}
+
+	TEST_CASE("TypeTraits_SerumDependencies")
+	{
+		SECTION("WhenTypeDeclaresDependencies_DependenciesAreDeclaredList")
+		{
+			REQUIRE(HasSerumDependencies<WithSerumDependencies>::value);
+			REQUIRE(std::is_same<Dependencies<int, std::string>, DependenciesOf<WithSerumDependencies>::Type>::value);
+		}
+
+		SECTION("WhenTypeDoesNotDeclareDependencies_DependenciesAreEmpty")
+		{
+			REQUIRE_FALSE(HasSerumDependencies<WithoutSerumConstructor>::value);
+			REQUIRE(std::is_same<Dependencies<>, DependenciesOf<WithoutSerumConstructor>::Type>::value);
+		}
+	}
+
+	TEST_CASE("TypeTraits_ConstructorDependencies")
+	{
+		SECTION("WhenTypeDeclaresDependencies_DependenciesAreDeclaredList")
+		{
+			REQUIRE(std::is_same<Dependencies<int, std::string>, ConstructorDependenciesOf<WithSerumDependencies>::Type>::value);
+		}
+
+		SECTION("WhenTypeHasSerumConstructor_DependenciesAreEmpty")
+		{
+			REQUIRE(std::is_same<Dependencies<>, ConstructorDependenciesOf<WithSerumConstructorAndDependencies>::Type>::value);
+		}
+	}
 }
@@ -0,0 +1,197 @@
+/// @file AllocationCounterTests.cpp
+/// Unit tests for the AllocationCounter type. These are built into Serum.Tests.AllocationHooks rather than Serum.Tests,
+/// as SERUM_INSTALL_ALLOCATION_HOOKS replaces the global allocation functions of the whole program.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum/Metrics/AllocationCounter.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <thread>
+
+SERUM_INSTALL_ALLOCATION_HOOKS();
+
+namespace Serum::Metrics::AllocationCounterTests
+{
+	void Allocate(std::size_t const bytes)
+	{
+		// The allocation functions are called directly, as new expressions may be elided.
+		::operator delete(::operator new(bytes));
+	}
+
+	struct LargeService final
+	{
+		static constexpr auto Size = std::size_t(4 * 1024 * 1024);
+
+		std::vector<char> buffer = std::vector<char>(Size);
+	};
+
+#ifdef SERUM_HAS_COROUTINES
+	class IntToDoubleResolver final : public AsyncSerumResolver<double>
+	{
+		public:
+			Async::Task<double> Resolve(SerumContainer& container, ResolutionContext& context) override
+			{
+				co_return static_cast<double>(co_await container.GetAsync<int>(context));
+			}
+	};
+#endif
+
+	TEST_CASE("AllocationCounter_GetThreadCounts")
+	{
+		SECTION("WhenHooksAreInstalled_IsInstalled")
+		{
+			REQUIRE(AllocationCounter::IsInstalled());
+		}
+
+		SECTION("WhenMemoryIsAllocated_CountsAllocation")
+		{
+			auto const before = AllocationCounter::GetThreadCounts();
+			Allocate(24);
+			auto const after = AllocationCounter::GetThreadCounts();
+
+			REQUIRE(1 == after.count - before.count);
+			REQUIRE(24 == after.bytes - before.bytes);
+		}
+
+		SECTION("WhenMemoryIsAllocatedOnAnotherThread_DoesNotCountAllocation")
+		{
+			auto thread = std::thread([] { Allocate(24); });
+			auto const before = AllocationCounter::GetThreadCounts();
+			thread.join();
+			auto const after = AllocationCounter::GetThreadCounts();
+
+			REQUIRE(before.count == after.count);
+		}
+	}
+
+	TEST_CASE("AllocationHooks_OperatorNew")
+	{
+		SECTION("WhenAllocationFails_CallsNewHandlerUntilThereIsNone")
+		{
+			static auto handlerCalls = 0;
+			handlerCalls = 0;
+
+			std::set_new_handler([]
+			{
+				++handlerCalls;
+				std::set_new_handler(nullptr);
+			});
+
+			REQUIRE_THROWS_AS(::operator new(std::numeric_limits<std::size_t>::max() / 2), std::bad_alloc);
+			REQUIRE(1 == handlerCalls);
+			REQUIRE(nullptr == std::get_new_handler());
+		}
+	}
+
+#ifdef SERUM_ENABLE_METRICS
+	TEST_CASE("AllocationCounter_GetStatistics")
+	{
+		SECTION("WhenBindingHasDependencies_CountsExclusiveAllocations")
+		{
+			auto container = SerumContainer();
+			container.BindFunction<int>([](ResolutionContext&)
+					 {
+						 Allocate(100);
+						 Allocate(100);
+						 return 1;
+					 })
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 Allocate(8);
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+
+			auto const statistics = container.GetStatistics();
+			auto const find = [&statistics](std::type_info const& type)
+			{
+				return *std::find_if(statistics.begin(), statistics.end(), [&type](BindingStatistics const& binding)
+				{
+					return binding.key == Bindings::BindingKey(type, "");
+				});
+			};
+
+			auto const intStatistics = find(typeid(int));
+			auto const doubleStatistics = find(typeid(double));
+
+			REQUIRE(2 == intStatistics.allocationCount);
+			REQUIRE(200 == intStatistics.allocatedBytes);
+			REQUIRE(2.0 == intStatistics.GetAllocationsPerResolution());
+			REQUIRE(1 <= doubleStatistics.allocationCount);
+			REQUIRE(8 <= doubleStatistics.allocatedBytes);
+			REQUIRE(200 > doubleStatistics.allocatedBytes);
+		}
+
+		SECTION("WhenSingletonIsConstructed_CountsAllocationsForSingletonBinding")
+		{
+			auto container = SerumContainer();
+			container.BindSingletonSharedPointer<LargeService>();
+
+			(void)container.Get<std::shared_ptr<LargeService>>();
+			(void)container.Get<std::shared_ptr<LargeService>>();
+
+			auto const statistics = container.GetStatistics();
+
+			REQUIRE(1 == statistics.size());
+			REQUIRE(Bindings::BindingType::Singleton == statistics[0].bindingType);
+			REQUIRE(2 == statistics[0].resolveCount);
+			REQUIRE(LargeService::Size <= statistics[0].allocatedBytes);
+			REQUIRE(0 < statistics[0].exclusiveTime.count());
+		}
+
+		SECTION("WhenPerResolutionBindingIsResolved_CountsAllocationsForPerResolutionBinding")
+		{
+			auto container = SerumContainer();
+			container.BindPerResolutionSharedPointer<LargeService>();
+
+			(void)container.Get<std::shared_ptr<LargeService>>();
+
+			auto const statistics = container.GetStatistics();
+
+			REQUIRE(1 == statistics.size());
+			REQUIRE(Bindings::BindingType::PerResolution == statistics[0].bindingType);
+			REQUIRE(LargeService::Size <= statistics[0].allocatedBytes);
+		}
+
+#ifdef SERUM_HAS_COROUTINES
+		SECTION("WhenAsyncResolverResumesOnAnotherThread_CountsEachThreadSeparately")
+		{
+			auto container = SerumContainer();
+			container.BindFunction<int>([](ResolutionContext&)
+					 {
+						 Allocate(100);
+						 return 1;
+					 })
+					 .BindAsyncResolver<double, IntToDoubleResolver>()
+					 .SetExecutor(std::make_shared<Async::ThreadPoolExecutor>(2));
+
+			// The calling thread has made far more allocations than the pool's threads, so subtracting counts taken
+			// on different threads would wrap around.
+			(void)Async::SyncWait(container.GetAsync<double>());
+			(void)container.Get<double>();
+
+			auto const statistics = container.GetStatistics();
+			auto const find = [&statistics](std::type_info const& type)
+			{
+				return *std::find_if(statistics.begin(), statistics.end(), [&type](BindingStatistics const& binding)
+				{
+					return binding.key == Bindings::BindingKey(type, "");
+				});
+			};
+
+			auto const intStatistics = find(typeid(int));
+			auto const doubleStatistics = find(typeid(double));
+
+			REQUIRE(2 == intStatistics.resolveCount);
+			REQUIRE(200 == intStatistics.allocatedBytes);
+			REQUIRE(2 == doubleStatistics.resolveCount);
+			REQUIRE(1024 * 1024 > doubleStatistics.allocatedBytes);
+		}
+#endif
+	}
+#endif
+}
@@ -0,0 +1,58 @@
+/// @file BindingMetricsTests.cpp
+/// Unit tests for the BindingMetrics type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum/Metrics/BindingMetrics.hpp"
+
+namespace Serum::Metrics::BindingMetricsTests
+{
+	TEST_CASE("BindingMetrics_GetStatistics")
+	{
+		auto const key = Bindings::BindingKey(typeid(int), "name");
+		auto metrics = BindingMetrics();
+
+		SECTION("WhenNothingIsRecorded_IsEmpty")
+		{
+			auto const statistics = metrics.GetStatistics(key, Bindings::BindingType::Function);
+
+			REQUIRE(key == statistics.key);
+			REQUIRE(Bindings::BindingType::Function == statistics.bindingType);
+			REQUIRE(0 == statistics.resolveCount);
+			REQUIRE(0 == statistics.latency.GetCount());
+			REQUIRE(0.0 == statistics.GetSingletonHitRate());
+		}
+
+		SECTION("WhenResolutionsAreRecorded_SumsTimes")
+		{
+			metrics.RecordResolution(100, 40, true);
+			metrics.RecordResolution(200, 60, false);
+
+			auto const statistics = metrics.GetStatistics(key, Bindings::BindingType::Function);
+
+			REQUIRE(2 == statistics.resolveCount);
+			REQUIRE(1 == statistics.failureCount);
+			REQUIRE(std::chrono::nanoseconds(300) == statistics.inclusiveTime);
+			REQUIRE(std::chrono::nanoseconds(100) == statistics.exclusiveTime);
+			REQUIRE(2 == statistics.latency.GetCount());
+		}
+
+		SECTION("WhenSingletonIsRecorded_ReportsHitRate")
+		{
+			metrics.RecordResolution(100, 100, true);
+			metrics.RecordSingletonConstruction(90);
+
+			for (auto i = 0; i < 3; ++i)
+			{
+				metrics.RecordResolution(1, 1, true);
+				metrics.RecordSingletonHit();
+			}
+
+			auto const statistics = metrics.GetStatistics(key, Bindings::BindingType::Singleton);
+
+			REQUIRE(std::chrono::nanoseconds(90) == statistics.singletonConstructionTime);
+			REQUIRE(3 == statistics.singletonHitCount);
+			REQUIRE(0.75 == statistics.GetSingletonHitRate());
+		}
+	}
+}
@@ -0,0 +1,97 @@
+/// @file LatencyHistogramTests.cpp
+/// Unit tests for the LatencyHistogram type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum/Metrics/LatencyHistogram.hpp"
+
+namespace Serum::Metrics::LatencyHistogramTests
+{
+	TEST_CASE("LatencyHistogram_GetBucketIndex")
+	{
+		SECTION("WhenDurationIsSmall_EachDurationHasItsOwnBucket")
+		{
+			for (auto nanoseconds = std::uint64_t(0); nanoseconds < LatencyHistogram::SubBucketCount; ++nanoseconds)
+			{
+				REQUIRE(nanoseconds == LatencyHistogram::GetBucketIndex(nanoseconds));
+			}
+		}
+
+		SECTION("DurationIsWithinBucketBounds")
+		{
+			for (auto nanoseconds = std::uint64_t(1); nanoseconds < (std::uint64_t(1) << 32); nanoseconds = nanoseconds * 3 + 1)
+			{
+				auto const bucketIndex = LatencyHistogram::GetBucketIndex(nanoseconds);
+
+				REQUIRE(LatencyHistogram::GetBucketLowerBound(bucketIndex) <= nanoseconds);
+				REQUIRE(nanoseconds < LatencyHistogram::GetBucketUpperBound(bucketIndex));
+			}
+		}
+
+		SECTION("BucketsAreContiguous")
+		{
+			for (auto bucketIndex = std::size_t(1); bucketIndex < LatencyHistogram::BucketCount; ++bucketIndex)
+			{
+				REQUIRE(LatencyHistogram::GetBucketUpperBound(bucketIndex - 1) == LatencyHistogram::GetBucketLowerBound(bucketIndex));
+			}
+		}
+
+		SECTION("WhenDurationIsTooLarge_UsesLastBucket")
+		{
+			REQUIRE(LatencyHistogram::BucketCount - 1 == LatencyHistogram::GetBucketIndex(~std::uint64_t(0)));
+		}
+	}
+
+	TEST_CASE("LatencyHistogram_GetPercentile")
+	{
+		auto histogram = LatencyHistogram();
+
+		SECTION("WhenEmpty_ReturnsZero")
+		{
+			REQUIRE(std::chrono::nanoseconds(0) == histogram.GetPercentile(50.0));
+		}
+
+		SECTION("WhenDurationsAreExact_ReturnsNearestRank")
+		{
+			histogram.Record(1);
+			histogram.Record(2);
+			histogram.Record(3);
+
+			REQUIRE(3 == histogram.GetCount());
+			REQUIRE(std::chrono::nanoseconds(1) == histogram.GetPercentile(0.0));
+			REQUIRE(std::chrono::nanoseconds(1) == histogram.GetPercentile(33.0));
+			REQUIRE(std::chrono::nanoseconds(2) == histogram.GetPercentile(50.0));
+			REQUIRE(std::chrono::nanoseconds(3) == histogram.GetPercentile(100.0));
+		}
+
+		SECTION("WhenDurationsAreLarge_IsWithinTwentyFivePercent")
+		{
+			for (auto i = 0; i < 99; ++i)
+			{
+				histogram.Record(1000);
+			}
+
+			histogram.Record(1000000);
+
+			auto const median = histogram.GetPercentile(50.0).count();
+			auto const maximum = histogram.GetPercentile(100.0).count();
+
+			REQUIRE(1000 <= median);
+			REQUIRE(median < 1250);
+			REQUIRE(1000000 <= maximum);
+			REQUIRE(maximum < 1250000);
+		}
+	}
+
+	TEST_CASE("LatencyHistogram_WhenConstructedFromBucketCounts_CountsTotal")
+	{
+		auto bucketCounts = std::array<std::uint64_t, LatencyHistogram::BucketCount>();
+		bucketCounts[0] = 2;
+		bucketCounts[10] = 3;
+
+		auto const histogram = LatencyHistogram(bucketCounts);
+
+		REQUIRE(5 == histogram.GetCount());
+		REQUIRE(3 == histogram.GetBucketCount(10));
+	}
+}
@@ -0,0 +1,88 @@
+/// @file LifetimeAdvisorContainerTests.cpp
+/// Tests of the AdviseLifetimes function with the statistics recorded by a container. These are built into
+/// Serum.Tests.AllocationHooks, so that the allocations made by each binding are counted.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum/Metrics/LifetimeAdvisor.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(SERUM_ENABLE_METRICS) && defined(SERUM_HAS_OBSERVERS)
+
+namespace Serum::Metrics::LifetimeAdvisorContainerTests
+{
+	struct LargeService final
+	{
+		std::vector<char> buffer = std::vector<char>(4 * 1024 * 1024);
+	};
+
+	struct Input final
+	{
+		int value = 0;
+	};
+
+	struct Shared final
+	{
+		std::shared_ptr<Input> input;
+		std::vector<int> values = std::vector<int>(16);
+	};
+
+	TEST_CASE("AdviseLifetimes_Container")
+	{
+		auto container = SerumContainer();
+		auto const recorder = std::make_shared<Observers::DependencyGraphRecorder>();
+		container.SetObserver(recorder);
+
+		SECTION("WhenSingletonIsLargeAndRarelyUsed_RecommendsTransient")
+		{
+			container.BindSingletonSharedPointer<LargeService>();
+			(void)container.Get<std::shared_ptr<LargeService>>();
+
+			auto const recommendations = AdviseLifetimes(container.GetStatistics(), container.GetDependencyGraph());
+
+			REQUIRE(1 == recommendations.size());
+			REQUIRE(Bindings::BindingLifetime::Transient == recommendations[0].recommendedLifetime);
+			REQUIRE(4 * 1024 * 1024 <= recommendations[0].estimatedBytesReleased);
+		}
+
+		SECTION("WhenTransientIsSharedInDiamond_RecommendsPerResolution")
+		{
+			container.BindFunction<std::shared_ptr<Input>>([](ResolutionContext&) { return std::make_shared<Input>(); })
+					 .BindFunction<Shared>([&container](ResolutionContext& context)
+					 {
+						 return Shared{ container.Get<std::shared_ptr<Input>>(context) };
+					 })
+					 .BindFunction<int>([&container](ResolutionContext& context)
+					 {
+						 return container.Get<Shared>(context).input->value;
+					 }, "left")
+					 .BindFunction<int>([&container](ResolutionContext& context)
+					 {
+						 return container.Get<Shared>(context).input->value;
+					 }, "right")
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context, "left") + container.Get<int>(context, "right"));
+					 });
+
+			for (auto get = 0; get < 1000; ++get)
+			{
+				(void)container.Get<double>();
+			}
+
+			auto const recommendations = AdviseLifetimes(container.GetStatistics(), container.GetDependencyGraph());
+			auto const shared = std::find_if(recommendations.begin(), recommendations.end(), [](auto const& recommendation)
+			{
+				return recommendation.key == Bindings::BindingKey(typeid(Shared), "");
+			});
+
+			REQUIRE(recommendations.end() != shared);
+			REQUIRE(Bindings::BindingLifetime::PerResolution == shared->recommendedLifetime);
+			REQUIRE(std::string::npos != shared->reason.find("1000 of them repeated"));
+		}
+	}
+}
+
+#endif
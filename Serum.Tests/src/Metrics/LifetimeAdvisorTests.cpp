@@ -0,0 +1,272 @@
+/// @file LifetimeAdvisorTests.cpp
+/// Unit tests for the AdviseLifetimes function.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum/Metrics/BindingMetrics.hpp"
+#include "Serum/Metrics/LifetimeAdvisor.hpp"
+
+namespace Serum::Metrics::LifetimeAdvisorTests
+{
+	using Bindings::BindingKey;
+	using Bindings::BindingLifetime;
+	using Bindings::BindingType;
+
+	BindingStatistics CreateStatistics(
+		BindingKey const& key,
+		BindingType const bindingType,
+		std::uint64_t const resolveCount,
+		std::uint64_t const nanoseconds,
+		std::uint64_t const allocations)
+	{
+		auto metrics = BindingMetrics();
+		for (auto resolution = std::uint64_t(0); resolution < resolveCount; ++resolution)
+		{
+			metrics.RecordResolution(nanoseconds, nanoseconds, true);
+			metrics.RecordAllocations(AllocationCounts{ allocations, allocations * 64 });
+		}
+
+		return metrics.GetStatistics(key, bindingType);
+	}
+
+	BindingStatistics CreateSingletonStatistics(BindingKey const& key, std::uint64_t const resolveCount, std::uint64_t const bytes)
+	{
+		auto metrics = BindingMetrics();
+		metrics.RecordResolution(1000, 1000, true);
+		metrics.RecordSingletonConstruction(900);
+		metrics.RecordAllocations(AllocationCounts{ 4, bytes });
+
+		for (auto resolution = std::uint64_t(1); resolution < resolveCount; ++resolution)
+		{
+			metrics.RecordResolution(10, 10, true);
+			metrics.RecordSingletonHit();
+		}
+
+		return metrics.GetStatistics(key, BindingType::Singleton);
+	}
+
+	DependencyGraphNode CreateNode(BindingKey const& key, BindingType const bindingType)
+	{
+		return DependencyGraphNode{ key, bindingType, Bindings::GetBindingLifetime(bindingType) };
+	}
+
+	TEST_CASE("AdviseLifetimes")
+	{
+		auto const service = BindingKey(typeid(int), "service");
+		auto const singleton = BindingKey(typeid(int), "singleton");
+		auto const transient = BindingKey(typeid(int), "transient");
+		auto const root = BindingKey(typeid(int), "root");
+		auto const nodes = std::vector<DependencyGraphNode>{
+			CreateNode(service, BindingType::Function),
+			CreateNode(singleton, BindingType::Singleton),
+			CreateNode(transient, BindingType::Function),
+			CreateNode(root, BindingType::Function)
+		};
+
+		SECTION("WhenTransientIsExpensiveWithSingletonDependencies_RecommendsSingleton")
+		{
+			auto const graph = DependencyGraph(nodes, { DependencyGraphEdge{ service, singleton, 2000, std::chrono::nanoseconds(2000) } });
+			auto const recommendations = AdviseLifetimes({ CreateStatistics(service, BindingType::Function, 2000, 5000, 2) }, graph);
+
+			REQUIRE(1 == recommendations.size());
+			REQUIRE(service == recommendations[0].key);
+			REQUIRE(BindingLifetime::Transient == recommendations[0].currentLifetime);
+			REQUIRE(BindingLifetime::Singleton == recommendations[0].recommendedLifetime);
+			REQUIRE(std::chrono::nanoseconds(5000 * 1999) == recommendations[0].estimatedTimeSaved);
+			REQUIRE(2 * 1999 == recommendations[0].estimatedAllocationsSaved);
+			REQUIRE(0 == recommendations[0].estimatedBytesReleased);
+			REQUIRE(std::string::npos != recommendations[0].reason.find("BindSingletonSharedPointer"));
+		}
+
+		SECTION("WhenTransientHasNoDependencies_RecommendsSingleton")
+		{
+			auto const recommendations = AdviseLifetimes(
+				{ CreateStatistics(service, BindingType::Function, 2000, 5000, 0) },
+				DependencyGraph(nodes, {}));
+
+			REQUIRE(1 == recommendations.size());
+			REQUIRE(BindingLifetime::Singleton == recommendations[0].recommendedLifetime);
+		}
+
+		SECTION("WhenTransientIsCheap_RecommendsNothing")
+		{
+			auto const recommendations = AdviseLifetimes(
+				{ CreateStatistics(service, BindingType::Function, 2000, 10, 0) },
+				DependencyGraph(nodes, {}));
+
+			REQUIRE(recommendations.empty());
+		}
+
+		SECTION("WhenTransientAllocates_RecommendsSingleton")
+		{
+			auto const recommendations = AdviseLifetimes(
+				{ CreateStatistics(service, BindingType::Function, 2000, 10, 3) },
+				DependencyGraph(nodes, {}));
+
+			REQUIRE(1 == recommendations.size());
+			REQUIRE(3 * 1999 == recommendations[0].estimatedAllocationsSaved);
+		}
+
+		SECTION("WhenTransientIsRarelyResolved_RecommendsNothing")
+		{
+			auto const recommendations = AdviseLifetimes(
+				{ CreateStatistics(service, BindingType::Function, 10, 5000, 2) },
+				DependencyGraph(nodes, {}));
+
+			REQUIRE(recommendations.empty());
+		}
+
+		SECTION("WhenTransientHasTransientDependency_RecommendsNothing")
+		{
+			auto const graph = DependencyGraph(nodes, { DependencyGraphEdge{ service, transient, 2000, std::chrono::nanoseconds(2000) } });
+			auto const recommendations = AdviseLifetimes({ CreateStatistics(service, BindingType::Function, 2000, 5000, 2) }, graph);
+
+			REQUIRE(recommendations.empty());
+		}
+
+		SECTION("WhenDependencyIsNotInGraph_RecommendsNothing")
+		{
+			auto const unknown = BindingKey(typeid(double), "");
+			auto const graph = DependencyGraph(nodes, { DependencyGraphEdge{ service, unknown, 2000, std::chrono::nanoseconds(2000) } });
+			auto const recommendations = AdviseLifetimes({ CreateStatistics(service, BindingType::Function, 2000, 5000, 2) }, graph);
+
+			REQUIRE(recommendations.empty());
+		}
+
+		SECTION("WhenTransientIsResolvedRepeatedlyWithinResolution_RecommendsPerResolution")
+		{
+			auto const graph = DependencyGraph(
+				nodes,
+				{
+					DependencyGraphEdge{ root, service, 3000, std::chrono::nanoseconds(3000) },
+					DependencyGraphEdge{ service, transient, 3000, std::chrono::nanoseconds(3000) }
+				});
+			auto const recommendations = AdviseLifetimes(
+				{
+					CreateStatistics(root, BindingType::Function, 1000, 10, 0),
+					CreateStatistics(service, BindingType::Function, 3000, 5000, 1)
+				},
+				graph);
+
+			REQUIRE(1 == recommendations.size());
+			REQUIRE(service == recommendations[0].key);
+			REQUIRE(BindingLifetime::PerResolution == recommendations[0].recommendedLifetime);
+			REQUIRE(std::chrono::nanoseconds(5000 * 2000) == recommendations[0].estimatedTimeSaved);
+			REQUIRE(2000 == recommendations[0].estimatedAllocationsSaved);
+		}
+
+		SECTION("WhenTransientIsSharedInDiamond_RecommendsPerResolution")
+		{
+			auto const left = BindingKey(typeid(double), "left");
+			auto const right = BindingKey(typeid(double), "right");
+			auto diamondNodes = nodes;
+			diamondNodes.push_back(CreateNode(left, BindingType::Function));
+			diamondNodes.push_back(CreateNode(right, BindingType::Function));
+
+			auto const graph = DependencyGraph(
+				diamondNodes,
+				{
+					DependencyGraphEdge{ root, left, 1000, std::chrono::nanoseconds(1000) },
+					DependencyGraphEdge{ root, right, 1000, std::chrono::nanoseconds(1000) },
+					DependencyGraphEdge{ left, service, 1000, std::chrono::nanoseconds(1000) },
+					DependencyGraphEdge{ right, service, 1000, std::chrono::nanoseconds(1000) },
+					DependencyGraphEdge{ service, transient, 2000, std::chrono::nanoseconds(2000) }
+				});
+			auto const recommendations = AdviseLifetimes(
+				{
+					CreateStatistics(root, BindingType::Function, 1000, 10, 0),
+					CreateStatistics(left, BindingType::Function, 1000, 10, 0),
+					CreateStatistics(right, BindingType::Function, 1000, 10, 0),
+					CreateStatistics(service, BindingType::Function, 2000, 5000, 1)
+				},
+				graph);
+
+			REQUIRE(1 == recommendations.size());
+			REQUIRE(service == recommendations[0].key);
+			REQUIRE(BindingLifetime::PerResolution == recommendations[0].recommendedLifetime);
+			REQUIRE(std::chrono::nanoseconds(5000 * 1000) == recommendations[0].estimatedTimeSaved);
+			REQUIRE(1000 == recommendations[0].estimatedAllocationsSaved);
+		}
+
+		SECTION("WhenTransientIsAlsoResolvedDirectly_CountsDirectResolutionsAsGets")
+		{
+			auto const graph = DependencyGraph(
+				nodes,
+				{
+					DependencyGraphEdge{ root, service, 1000, std::chrono::nanoseconds(1000) },
+					DependencyGraphEdge{ service, transient, 2000, std::chrono::nanoseconds(2000) }
+				});
+			auto const recommendations = AdviseLifetimes(
+				{
+					CreateStatistics(root, BindingType::Function, 1000, 10, 0),
+					CreateStatistics(service, BindingType::Function, 2000, 5000, 1)
+				},
+				graph);
+
+			REQUIRE(recommendations.empty());
+		}
+
+		SECTION("WhenBindingFailed_RecommendsNothing")
+		{
+			auto statistics = CreateStatistics(service, BindingType::Function, 2000, 5000, 2);
+			statistics.failureCount = 1;
+
+			REQUIRE(AdviseLifetimes({ statistics }, DependencyGraph(nodes, {})).empty());
+		}
+
+		SECTION("WhenSingletonIsLargeAndRarelyUsed_RecommendsTransient")
+		{
+			auto const recommendations = AdviseLifetimes(
+				{ CreateSingletonStatistics(singleton, 1, 2 * 1024 * 1024) },
+				DependencyGraph(nodes, {}));
+
+			REQUIRE(1 == recommendations.size());
+			REQUIRE(singleton == recommendations[0].key);
+			REQUIRE(BindingLifetime::Singleton == recommendations[0].currentLifetime);
+			REQUIRE(BindingLifetime::Transient == recommendations[0].recommendedLifetime);
+			REQUIRE(2 * 1024 * 1024 == recommendations[0].estimatedBytesReleased);
+			REQUIRE(std::chrono::nanoseconds(0) == recommendations[0].estimatedTimeSaved);
+		}
+
+		SECTION("WhenSingletonIsShared_RecommendsNothing")
+		{
+			auto const recommendations = AdviseLifetimes(
+				{ CreateSingletonStatistics(singleton, 50, 2 * 1024 * 1024) },
+				DependencyGraph(nodes, {}));
+
+			REQUIRE(recommendations.empty());
+		}
+
+		SECTION("WhenThresholdsAreChanged_UsesThresholds")
+		{
+			auto thresholds = LifetimeAdvisorThresholds();
+			thresholds.maximumSingletonResolveCount = 5;
+			thresholds.minimumSingletonBytes = 1024;
+
+			auto const recommendations = AdviseLifetimes(
+				{ CreateSingletonStatistics(singleton, 5, 2048) },
+				DependencyGraph(nodes, {}),
+				thresholds);
+
+			REQUIRE(1 == recommendations.size());
+			REQUIRE(std::chrono::nanoseconds(-900 * 4) == recommendations[0].estimatedTimeSaved);
+			REQUIRE(-4 * 4 == recommendations[0].estimatedAllocationsSaved);
+		}
+
+		SECTION("WhenSeveralAreRecommended_OrdersByTimeSaved")
+		{
+			auto const recommendations = AdviseLifetimes(
+				{
+					CreateSingletonStatistics(singleton, 1, 2 * 1024 * 1024),
+					CreateStatistics(service, BindingType::Function, 2000, 2000, 0),
+					CreateStatistics(transient, BindingType::Function, 2000, 8000, 0)
+				},
+				DependencyGraph(nodes, {}));
+
+			REQUIRE(3 == recommendations.size());
+			REQUIRE(transient == recommendations[0].key);
+			REQUIRE(service == recommendations[1].key);
+			REQUIRE(singleton == recommendations[2].key);
+		}
+	}
+}
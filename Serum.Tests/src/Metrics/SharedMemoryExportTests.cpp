@@ -0,0 +1,146 @@
+/// @file SharedMemoryExportTests.cpp
+/// Unit tests for the SharedMemoryExporter and SharedMemoryReader types.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+#include "Serum/Metrics/BindingMetrics.hpp"
+#include "Serum/Metrics/SharedMemoryExport.hpp"
+
+#ifdef SERUM_HAS_SHARED_MEMORY
+
+#include <atomic>
+#include <thread>
+
+namespace Serum::Metrics::SharedMemoryExportTests
+{
+	std::string GetRegionName()
+	{
+		return "/serum-tests-" + std::to_string(::getpid());
+	}
+
+	BindingStatistics CreateStatistics(std::string const& name, std::uint64_t const resolveCount)
+	{
+		auto metrics = BindingMetrics();
+		for (auto resolution = std::uint64_t(0); resolution < resolveCount; ++resolution)
+		{
+			metrics.RecordResolution(100, 40, resolution % 2 == 0);
+		}
+
+		return metrics.GetStatistics(Bindings::BindingKey(typeid(int), name), Bindings::BindingType::Function);
+	}
+
+	TEST_CASE("SharedMemoryReader_Read")
+	{
+		auto const name = GetRegionName();
+		auto exporter = SharedMemoryExporter(name, 2);
+
+		SECTION("WhenNothingIsPublished_IsEmpty")
+		{
+			auto const reader = SharedMemoryReader(name);
+
+			REQUIRE(reader.Read().empty());
+			REQUIRE(0 == reader.GetPublishCount());
+			REQUIRE(static_cast<std::uint64_t>(::getpid()) == reader.GetWriterProcessId());
+		}
+
+		SECTION("WhenStatisticsArePublished_ReadsEveryField")
+		{
+			auto const published = CreateStatistics("first", 3);
+			exporter.Publish({ published });
+
+			auto const reader = SharedMemoryReader(name);
+			auto const statistics = reader.Read();
+
+			REQUIRE(1 == statistics.size());
+			REQUIRE(published.key.ToString() == statistics[0].key);
+			REQUIRE(Bindings::BindingType::Function == statistics[0].bindingType);
+			REQUIRE(3 == statistics[0].resolveCount);
+			REQUIRE(1 == statistics[0].failureCount);
+			REQUIRE(std::chrono::nanoseconds(300) == statistics[0].inclusiveTime);
+			REQUIRE(std::chrono::nanoseconds(120) == statistics[0].exclusiveTime);
+			REQUIRE(3 == statistics[0].latency.GetCount());
+			REQUIRE(published.latency.GetPercentile(50.0) == statistics[0].latency.GetPercentile(50.0));
+			REQUIRE(1 == reader.GetPublishCount());
+		}
+
+		SECTION("WhenPublishedAgain_UpdatesSameRecords")
+		{
+			exporter.Publish({ CreateStatistics("first", 1) });
+			exporter.Publish({ CreateStatistics("second", 2), CreateStatistics("first", 3) });
+
+			auto const statistics = SharedMemoryReader(name).Read();
+
+			REQUIRE(2 == statistics.size());
+			REQUIRE(3 == statistics[0].resolveCount);
+			REQUIRE(2 == statistics[1].resolveCount);
+		}
+
+		SECTION("WhenCapacityIsExceeded_CountsDroppedBindings")
+		{
+			exporter.Publish({ CreateStatistics("first", 1), CreateStatistics("second", 1), CreateStatistics("third", 1) });
+
+			auto const reader = SharedMemoryReader(name);
+
+			REQUIRE(2 == reader.Read().size());
+			REQUIRE(1 == reader.GetDroppedCount());
+		}
+
+		SECTION("WhenKeyIsLong_TruncatesKey")
+		{
+			exporter.Publish({ CreateStatistics(std::string(200, 'x'), 1) });
+
+			REQUIRE(SharedMemoryKeyLength - 1 == SharedMemoryReader(name).Read()[0].key.size());
+		}
+
+		SECTION("WhenPublishedConcurrently_NeverReadsPartialRecords")
+		{
+			auto isPublishing = std::atomic<bool>(true);
+			auto publisher = std::thread([&exporter, &isPublishing]
+			{
+				for (auto resolveCount = std::uint64_t(1); resolveCount <= 200; ++resolveCount)
+				{
+					exporter.Publish({ CreateStatistics("first", resolveCount) });
+				}
+
+				isPublishing = false;
+			});
+
+			auto const reader = SharedMemoryReader(name);
+			auto isConsistent = true;
+
+			while (isPublishing)
+			{
+				for (auto const& statistics : reader.Read())
+				{
+					isConsistent = isConsistent
+						&& statistics.inclusiveTime == std::chrono::nanoseconds(100 * statistics.resolveCount)
+						&& statistics.latency.GetCount() == statistics.resolveCount;
+				}
+			}
+
+			publisher.join();
+
+			REQUIRE(isConsistent);
+			REQUIRE(200 == reader.Read()[0].resolveCount);
+		}
+	}
+
+	TEST_CASE("SharedMemoryReader_Constructor")
+	{
+		SECTION("WhenRegionDoesNotExist_Throws")
+		{
+			REQUIRE_THROWS_AS(SharedMemoryReader(GetRegionName() + "-missing"), SerumException);
+		}
+
+		SECTION("WhenExporterIsDestroyed_RemovesRegion")
+		{
+			{
+				auto const exporter = SharedMemoryExporter(GetRegionName());
+			}
+
+			REQUIRE_THROWS_AS(SharedMemoryReader(GetRegionName()), SerumException);
+		}
+	}
+}
+
+#endif // SERUM_HAS_SHARED_MEMORY
@@ -0,0 +1,88 @@
+/// @file CompositeObserverTests.cpp
+/// Unit tests for the CompositeObserver type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+namespace Serum::Observers::CompositeObserverTests
+{
+	class CountingObserver final : public SerumObserver
+	{
+		public:
+			std::size_t numberOfBegins = 0;
+			std::size_t numberOfEnds = 0;
+			std::size_t numberOfSingletons = 0;
+
+			void OnResolveBegin(Bindings::BindingKey const&, std::size_t) override
+			{
+				++numberOfBegins;
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const&, std::chrono::nanoseconds, bool) override
+			{
+				++numberOfEnds;
+			}
+
+			void OnSingletonCreated(Bindings::BindingKey const&, std::chrono::nanoseconds) override
+			{
+				++numberOfSingletons;
+			}
+	};
+
+	TEST_CASE("CompositeObserver_Add")
+	{
+		SECTION("WhenObserverIsNull_IsIgnored")
+		{
+			auto composite = CompositeObserver({ nullptr });
+			composite.Add(nullptr);
+
+			REQUIRE(0 == composite.GetNumberOfObservers());
+		}
+
+		SECTION("WhenObserversAreAdded_CountsObservers")
+		{
+			auto composite = CompositeObserver({ std::make_shared<CountingObserver>() });
+			composite.Add(std::make_shared<CountingObserver>());
+
+			REQUIRE(2 == composite.GetNumberOfObservers());
+		}
+	}
+
+	TEST_CASE("CompositeObserver_OnResolve")
+	{
+		auto const key = Bindings::BindingKey(typeid(int), "");
+		auto first = std::make_shared<CountingObserver>();
+		auto second = std::make_shared<CountingObserver>();
+		auto composite = CompositeObserver({ first, second });
+
+		SECTION("ForwardsEventsToEveryObserver")
+		{
+			composite.OnResolveBegin(key, 0);
+			composite.OnSingletonCreated(key, std::chrono::nanoseconds(1));
+			composite.OnResolveEnd(key, std::chrono::nanoseconds(2), true);
+
+			for (auto const& observer : { first, second })
+			{
+				REQUIRE(1 == observer->numberOfBegins);
+				REQUIRE(1 == observer->numberOfSingletons);
+				REQUIRE(1 == observer->numberOfEnds);
+			}
+		}
+
+		SECTION("WhenAttachedToContainer_ObservesResolutions")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<int>(1)
+					 .SetObserver(std::make_shared<CompositeObserver>(composite));
+
+			(void)container.Get<int>();
+
+			REQUIRE(1 == first->numberOfEnds);
+			REQUIRE(1 == second->numberOfEnds);
+		}
+	}
+}
+
+#endif // SERUM_HAS_OBSERVERS
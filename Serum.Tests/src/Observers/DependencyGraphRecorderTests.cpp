@@ -0,0 +1,114 @@
+/// @file DependencyGraphRecorderTests.cpp
+/// Unit tests for the DependencyGraphRecorder type.
+
+#include "catch.hpp"
+#include "Serum.Tests/TestType.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <thread>
+
+namespace Serum::Observers::DependencyGraphRecorderTests
+{
+	struct SingletonDependent final
+	{
+		using SerumDependencies = Dependencies<int>;
+
+		explicit SingletonDependent(int)
+		{
+		}
+	};
+
+	TEST_CASE("DependencyGraphRecorder_GetEdges")
+	{
+		auto const intKey = Bindings::BindingKey(typeid(int), "");
+		auto const doubleKey = Bindings::BindingKey(typeid(double), "");
+		auto recorder = std::make_shared<DependencyGraphRecorder>();
+		auto container = SerumContainer();
+		container.SetObserver(recorder);
+
+		SECTION("WhenNothingIsResolved_IsEmpty")
+		{
+			REQUIRE(recorder->GetEdges().empty());
+		}
+
+		SECTION("WhenBindingHasNoDependencies_IsEmpty")
+		{
+			container.BindConstant<int>(1);
+
+			(void)container.Get<int>();
+
+			REQUIRE(recorder->GetEdges().empty());
+		}
+
+		SECTION("WhenDependencyIsResolved_CountsResolutions")
+		{
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context) + container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+			(void)container.Get<double>();
+
+			auto const edges = recorder->GetEdges();
+
+			REQUIRE(1 == edges.size());
+			REQUIRE(doubleKey == edges[0].dependent);
+			REQUIRE(intKey == edges[0].dependency);
+			REQUIRE(4 == edges[0].resolveCount);
+			REQUIRE(std::chrono::nanoseconds(0) <= edges[0].totalTime);
+		}
+
+		SECTION("WhenDependentIsSingleton_DoesNotRecordItself")
+		{
+			container.BindConstant<int>(1)
+					 .BindSingletonSharedPointer<SingletonDependent>();
+
+			(void)container.Get<std::shared_ptr<SingletonDependent>>();
+			(void)container.Get<std::shared_ptr<SingletonDependent>>();
+
+			auto const edges = recorder->GetEdges();
+
+			REQUIRE(1 == edges.size());
+			REQUIRE(Bindings::BindingKey(typeid(std::shared_ptr<SingletonDependent>), "") == edges[0].dependent);
+			REQUIRE(1 == edges[0].resolveCount);
+		}
+
+		SECTION("WhenResolvedOnSeveralThreads_MergesThreads")
+		{
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+			auto thread = std::thread([&container] { (void)container.Get<double>(); });
+			thread.join();
+
+			auto const edges = recorder->GetEdges();
+
+			REQUIRE(1 == edges.size());
+			REQUIRE(2 == edges[0].resolveCount);
+		}
+
+		SECTION("WhenCleared_IsEmpty")
+		{
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+			recorder->Clear();
+
+			REQUIRE(recorder->GetEdges().empty());
+		}
+	}
+}
+
+#endif // SERUM_HAS_OBSERVERS
@@ -0,0 +1,144 @@
+/// @file FlightRecorderTests.cpp
+/// Unit tests for the FlightRecorder type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <thread>
+
+namespace Serum::Observers::FlightRecorderTests
+{
+	TEST_CASE("FlightRecorder_Constructor")
+	{
+		SECTION("RoundsCapacityUpToPowerOfTwo")
+		{
+			REQUIRE(1 == FlightRecorder(0).GetCapacity());
+			REQUIRE(8 == FlightRecorder(5).GetCapacity());
+			REQUIRE(256 == FlightRecorder().GetCapacity());
+		}
+	}
+
+	TEST_CASE("FlightRecorder_GetRecords")
+	{
+		auto const intKey = Bindings::BindingKey(typeid(int), "");
+		auto const doubleKey = Bindings::BindingKey(typeid(double), "");
+
+		SECTION("WhenNothingIsResolved_IsEmpty")
+		{
+			REQUIRE(FlightRecorder().GetRecords().empty());
+		}
+
+		SECTION("WhenResolutionFails_RecordsPathToFailure")
+		{
+			auto recorder = std::make_shared<FlightRecorder>();
+			auto container = SerumContainer();
+			container.BindFunction<int>([](ResolutionContext&) -> int { throw SerumException("Failed."); })
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 })
+					 .SetObserver(recorder);
+
+			REQUIRE_THROWS_AS(container.Get<double>(), SerumException);
+
+			auto const records = recorder->GetRecords();
+
+			REQUIRE(4 == records.size());
+			REQUIRE(FlightRecordType::Begin == records[0].type);
+			REQUIRE(doubleKey == records[0].key);
+			REQUIRE(0 == records[0].depth);
+			REQUIRE(FlightRecordType::Begin == records[1].type);
+			REQUIRE(intKey == records[1].key);
+			REQUIRE(1 == records[1].depth);
+			REQUIRE(FlightRecordType::End == records[2].type);
+			REQUIRE(intKey == records[2].key);
+			REQUIRE(1 == records[2].depth);
+			REQUIRE_FALSE(records[2].succeeded);
+			REQUIRE(FlightRecordType::End == records[3].type);
+			REQUIRE_FALSE(records[3].succeeded);
+
+			for (auto index = std::size_t(0); index < records.size(); ++index)
+			{
+				REQUIRE(index == records[index].sequence);
+			}
+		}
+
+		SECTION("WhenRingIsFull_KeepsMostRecentEvents")
+		{
+			auto recorder = FlightRecorder(4);
+
+			for (auto depth = std::size_t(0); depth < 6; ++depth)
+			{
+				recorder.OnResolveBegin(intKey, depth);
+			}
+
+			auto const records = recorder.GetRecords();
+
+			REQUIRE(4 == records.size());
+			REQUIRE(2 == records[0].sequence);
+			REQUIRE(2 == records[0].depth);
+			REQUIRE(5 == records[3].sequence);
+		}
+
+		SECTION("WhenNameIsLong_TruncatesName")
+		{
+			auto recorder = FlightRecorder();
+			auto const name = std::string(FlightRecorder::MaxNameLength + 10, 'x');
+
+			recorder.OnResolveBegin(Bindings::BindingKey(typeid(int), name), 0);
+
+			REQUIRE(name.substr(0, FlightRecorder::MaxNameLength) == recorder.GetRecords()[0].key.GetName());
+		}
+
+		SECTION("WhenNameFitsAndEntryIsReused_KeepsWholeName")
+		{
+			auto recorder = FlightRecorder(1);
+			auto const alphabet = std::string("abcdefghijklmnopqrstuvwxyz");
+
+			for (auto length = std::size_t(0); length <= FlightRecorder::MaxNameLength; ++length)
+			{
+				auto const name = alphabet.substr(0, length);
+				recorder.OnResolveBegin(Bindings::BindingKey(typeid(int), alphabet.substr(0, FlightRecorder::MaxNameLength)), 0);
+				recorder.OnResolveBegin(Bindings::BindingKey(typeid(int), name), 0);
+
+				REQUIRE(name == recorder.GetRecords()[0].key.GetName());
+			}
+		}
+
+		SECTION("WhenResolvedOnSeveralThreads_KeepsRingPerThread")
+		{
+			auto recorder = FlightRecorder();
+
+			recorder.OnResolveBegin(intKey, 0);
+			auto thread = std::thread([&recorder, &doubleKey] { recorder.OnResolveBegin(doubleKey, 0); });
+			thread.join();
+
+			auto const records = recorder.GetRecords();
+
+			REQUIRE(2 == records.size());
+			REQUIRE(records[0].threadIndex != records[1].threadIndex);
+			REQUIRE(0 == records[1].sequence);
+		}
+	}
+
+	TEST_CASE("FlightRecorder_ToString")
+	{
+		SECTION("WritesOneLinePerEvent")
+		{
+			auto recorder = FlightRecorder();
+			auto const key = Bindings::BindingKey(typeid(int), "");
+
+			recorder.OnResolveBegin(key, 0);
+			recorder.OnResolveEnd(key, std::chrono::nanoseconds(42), false);
+
+			auto const text = recorder.ToString();
+
+			REQUIRE(0 == text.find("thread 1 #0 begin " + key.ToString() + "\n"));
+			REQUIRE(std::string::npos != text.find("thread 1 #1 end " + key.ToString() + " failed after 42ns\n"));
+		}
+	}
+}
+
+#endif // SERUM_HAS_OBSERVERS
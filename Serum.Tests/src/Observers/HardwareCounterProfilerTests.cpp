@@ -0,0 +1,178 @@
+/// @file HardwareCounterProfilerTests.cpp
+/// Unit tests for the HardwareCounterProfiler type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_PERF_EVENTS
+
+#include <algorithm>
+#include <thread>
+
+namespace Serum::Observers::HardwareCounterProfilerTests
+{
+	struct SingletonDependent final
+	{
+		using SerumDependencies = Dependencies<int>;
+
+		explicit SingletonDependent(int)
+		{
+		}
+	};
+
+	// Spins on the CPU rather than sleeping, as sleeping takes no CPU time.
+	int Spin(std::chrono::milliseconds const duration)
+	{
+		auto const end = std::chrono::steady_clock::now() + duration;
+		auto volatile iterations = 0;
+
+		while (std::chrono::steady_clock::now() < end)
+		{
+			iterations = iterations + 1;
+		}
+
+		return 1;
+	}
+
+	HardwareCounterStatistics const& Find(std::vector<HardwareCounterStatistics> const& statistics, Bindings::BindingKey const& key)
+	{
+		auto const iterator = std::find_if(statistics.begin(), statistics.end(), [&key](auto const& binding)
+		{
+			return binding.key == key;
+		});
+
+		REQUIRE(iterator != statistics.end());
+
+		return *iterator;
+	}
+
+	TEST_CASE("HardwareCounterProfiler_GetStatistics")
+	{
+		auto const intKey = Bindings::BindingKey(typeid(int), "");
+		auto const doubleKey = Bindings::BindingKey(typeid(double), "");
+		auto profiler = std::make_shared<HardwareCounterProfiler>();
+		auto container = SerumContainer();
+		container.SetObserver(profiler);
+
+		SECTION("WhenNothingIsResolved_IsEmpty")
+		{
+			REQUIRE(profiler->GetStatistics().empty());
+		}
+
+		SECTION("WhenBindingsAreResolved_CountsEachResolution")
+		{
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+			(void)container.Get<double>();
+			(void)container.Get<int>();
+
+			auto const statistics = profiler->GetStatistics();
+
+			REQUIRE(2 == statistics.size());
+			REQUIRE(2 == Find(statistics, doubleKey).resolveCount);
+			REQUIRE(3 == Find(statistics, intKey).resolveCount);
+		}
+
+		SECTION("WhenBindingHasDependencies_CpuTimeExcludesDependencies")
+		{
+			constexpr auto dependencyTime = std::chrono::milliseconds(20);
+			container.BindFunction<int>([dependencyTime](ResolutionContext&) { return Spin(dependencyTime); })
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+
+			auto const statistics = profiler->GetStatistics();
+			auto const& dependency = Find(statistics, intKey);
+			auto const& dependent = Find(statistics, doubleKey);
+
+			REQUIRE(dependency.cpuTime >= std::chrono::milliseconds(1));
+			REQUIRE(dependent.cpuTime < dependency.cpuTime);
+		}
+
+		SECTION("WhenBindingIsSingleton_CountsWrappedBindingAsOneResolution")
+		{
+			container.BindConstant<int>(1)
+					 .BindSingletonSharedPointer<SingletonDependent>();
+
+			(void)container.Get<std::shared_ptr<SingletonDependent>>();
+
+			auto const singletonKey = Bindings::BindingKey(typeid(std::shared_ptr<SingletonDependent>), "");
+			auto const statistics = profiler->GetStatistics();
+
+			REQUIRE(1 == Find(statistics, singletonKey).resolveCount);
+			REQUIRE(1 == Find(statistics, intKey).resolveCount);
+		}
+
+		SECTION("WhenResolvedOnSeveralThreads_MergesThreads")
+		{
+			container.BindConstant<int>(1);
+
+			(void)container.Get<int>();
+			auto thread = std::thread([&container] { (void)container.Get<int>(); });
+			thread.join();
+
+			REQUIRE(2 == Find(profiler->GetStatistics(), intKey).resolveCount);
+		}
+
+		SECTION("ReportsHardwareCountersOnlyWhenAvailable")
+		{
+			container.BindFunction<int>([](ResolutionContext&) { return Spin(std::chrono::milliseconds(1)); });
+
+			(void)container.Get<int>();
+
+			auto const statistics = Find(profiler->GetStatistics(), intKey);
+
+			if (HardwareCounterProfiler::AreHardwareCountersAvailable())
+			{
+				REQUIRE(statistics.hasHardwareCounters);
+				REQUIRE(statistics.instructions > 0);
+			}
+			else
+			{
+				REQUIRE_FALSE(statistics.hasHardwareCounters);
+				REQUIRE(0 == statistics.cycles);
+				REQUIRE(0 == statistics.instructions);
+				REQUIRE(0 == statistics.cacheMisses);
+				REQUIRE(0.0 == statistics.GetInstructionsPerCycle());
+			}
+		}
+	}
+
+	TEST_CASE("HardwareCounterProfiler_Clear")
+	{
+		SECTION("DiscardsStatistics")
+		{
+			auto profiler = HardwareCounterProfiler();
+			auto const key = Bindings::BindingKey(typeid(int), "");
+
+			profiler.OnResolveBegin(key, 0);
+			profiler.OnResolveEnd(key, std::chrono::nanoseconds(0), true);
+			profiler.Clear();
+
+			REQUIRE(profiler.GetStatistics().empty());
+		}
+	}
+
+	TEST_CASE("HardwareCounterStatistics_Ratios")
+	{
+		SECTION("DividesCounters")
+		{
+			auto const statistics = HardwareCounterStatistics{
+				Bindings::BindingKey(typeid(int), ""), 1, std::chrono::nanoseconds(0), 200, 400, 2, true
+			};
+
+			REQUIRE(2.0 == statistics.GetInstructionsPerCycle());
+			REQUIRE(5.0 == statistics.GetCacheMissesPerThousandInstructions());
+		}
+	}
+}
+
+#endif // SERUM_HAS_PERF_EVENTS
@@ -0,0 +1,159 @@
+/// @file ResolutionProfilerTests.cpp
+/// Unit tests for the ResolutionProfiler type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <thread>
+
+namespace Serum::Observers::ResolutionProfilerTests
+{
+	struct SingletonDependent final
+	{
+		using SerumDependencies = Dependencies<int>;
+
+		explicit SingletonDependent(int)
+		{
+		}
+	};
+
+	TEST_CASE("ResolutionProfiler_GetStacks")
+	{
+		auto const intKey = Bindings::BindingKey(typeid(int), "");
+		auto const doubleKey = Bindings::BindingKey(typeid(double), "");
+		auto profiler = std::make_shared<ResolutionProfiler>();
+		auto container = SerumContainer();
+		container.SetObserver(profiler);
+
+		SECTION("WhenNothingIsResolved_IsEmpty")
+		{
+			REQUIRE(profiler->GetStacks().empty());
+		}
+
+		SECTION("WhenBindingHasDependencies_ProfilesEachPath")
+		{
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+			(void)container.Get<double>();
+			(void)container.Get<int>();
+
+			auto const stacks = profiler->GetStacks();
+
+			REQUIRE(3 == stacks.size());
+
+			for (auto const& stack : stacks)
+			{
+				REQUIRE(stack.exclusiveTime <= stack.inclusiveTime);
+
+				if (stack.path == std::vector<Bindings::BindingKey>{ doubleKey })
+				{
+					REQUIRE(2 == stack.resolveCount);
+				}
+				else if (stack.path == std::vector<Bindings::BindingKey>{ doubleKey, intKey })
+				{
+					REQUIRE(2 == stack.resolveCount);
+				}
+				else
+				{
+					REQUIRE(std::vector<Bindings::BindingKey>{ intKey } == stack.path);
+					REQUIRE(1 == stack.resolveCount);
+				}
+			}
+		}
+
+		SECTION("WhenBindingHasDependencies_ExclusiveTimeExcludesDependencies")
+		{
+			constexpr auto dependencyTime = std::chrono::milliseconds(5);
+			container.BindFunction<int>([dependencyTime](ResolutionContext&)
+					 {
+						 std::this_thread::sleep_for(dependencyTime);
+						 return 1;
+					 })
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+
+			auto const stacks = profiler->GetStacks();
+
+			REQUIRE(2 == stacks.size());
+			REQUIRE(std::vector<Bindings::BindingKey>{ doubleKey } == stacks[0].path);
+			REQUIRE(stacks[0].inclusiveTime >= dependencyTime);
+			REQUIRE(stacks[0].exclusiveTime < dependencyTime);
+			REQUIRE(stacks[1].exclusiveTime >= dependencyTime);
+		}
+
+		SECTION("WhenBindingIsSingleton_ProfilesOneFrame")
+		{
+			container.BindConstant<int>(1)
+					 .BindSingletonSharedPointer<SingletonDependent>();
+
+			(void)container.Get<std::shared_ptr<SingletonDependent>>();
+
+			auto const singletonKey = Bindings::BindingKey(typeid(std::shared_ptr<SingletonDependent>), "");
+			auto const stacks = profiler->GetStacks();
+
+			REQUIRE(2 == stacks.size());
+			REQUIRE(std::vector<Bindings::BindingKey>{ singletonKey } == stacks[0].path);
+			REQUIRE(1 == stacks[0].resolveCount);
+			REQUIRE((std::vector<Bindings::BindingKey>{ singletonKey, intKey }) == stacks[1].path);
+		}
+
+		SECTION("WhenResolvedOnSeveralThreads_MergesThreads")
+		{
+			container.BindConstant<int>(1);
+
+			(void)container.Get<int>();
+			auto thread = std::thread([&container] { (void)container.Get<int>(); });
+			thread.join();
+
+			auto const stacks = profiler->GetStacks();
+
+			REQUIRE(1 == stacks.size());
+			REQUIRE(2 == stacks[0].resolveCount);
+		}
+	}
+
+	TEST_CASE("ResolutionProfiler_ToFoldedStacks")
+	{
+		auto profiler = ResolutionProfiler();
+		auto const dependent = Bindings::BindingKey(typeid(double), "a");
+		auto const dependency = Bindings::BindingKey(typeid(int), "b;c");
+
+		profiler.OnResolveBegin(dependent, 0);
+		profiler.OnResolveBegin(dependency, 1);
+		profiler.OnResolveEnd(dependency, std::chrono::nanoseconds(30), true);
+		profiler.OnResolveEnd(dependent, std::chrono::nanoseconds(100), true);
+
+		auto const dependentFrame = std::string("[") + typeid(double).name() + ",_\"a\"]";
+		auto const dependencyFrame = std::string("[") + typeid(int).name() + ",_\"b:c\"]";
+
+		SECTION("WhenTimeIsExclusive_WritesExclusiveTime")
+		{
+			REQUIRE(dependentFrame + " 70\n" + dependentFrame + ";" + dependencyFrame + " 30\n" == profiler.ToFoldedStacks());
+		}
+
+		SECTION("WhenTimeIsInclusive_WritesInclusiveTime")
+		{
+			REQUIRE(dependentFrame + " 100\n" + dependentFrame + ";" + dependencyFrame + " 30\n" == profiler.ToFoldedStacks(ProfileTime::Inclusive));
+		}
+
+		SECTION("WhenCleared_WritesNothing")
+		{
+			profiler.Clear();
+
+			REQUIRE(profiler.ToFoldedStacks().empty());
+		}
+	}
+}
+
+#endif // SERUM_HAS_OBSERVERS
@@ -0,0 +1,130 @@
+/// @file TraceRecorderTests.cpp
+/// Unit tests for the TraceRecorder type.
+
+#include "catch.hpp"
+#include "Serum.Tests/TestType.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <algorithm>
+#include <thread>
+
+namespace Serum::Observers::TraceRecorderTests
+{
+	TEST_CASE("TraceRecorder_GetEvents")
+	{
+		auto const intKey = Bindings::BindingKey(typeid(int), "");
+		auto const doubleKey = Bindings::BindingKey(typeid(double), "");
+		auto recorder = std::make_shared<TraceRecorder>();
+		auto container = SerumContainer();
+		container.SetObserver(recorder);
+
+		SECTION("WhenNothingIsResolved_IsEmpty")
+		{
+			REQUIRE(recorder->GetEvents().empty());
+		}
+
+		SECTION("WhenBindingHasDependencies_RecordsNesting")
+		{
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+
+			auto const events = recorder->GetEvents();
+
+			REQUIRE(2 == events.size());
+			REQUIRE(doubleKey == events[0].key);
+			REQUIRE(0 == events[0].depth);
+			REQUIRE(intKey == events[1].key);
+			REQUIRE(1 == events[1].depth);
+			REQUIRE(events[0].start <= events[1].start);
+			REQUIRE(events[1].start + events[1].duration <= events[0].start + events[0].duration);
+			REQUIRE(events[0].threadIndex == events[1].threadIndex);
+		}
+
+		SECTION("WhenSingletonIsCreated_RecordsCreation")
+		{
+			container.BindSingletonSharedPointer<TestType>();
+
+			(void)container.Get<std::shared_ptr<TestType>>();
+
+			auto const events = recorder->GetEvents();
+			auto const creation = std::find_if(events.begin(), events.end(), [](TraceEvent const& event)
+			{
+				return event.type == TraceEventType::SingletonCreation;
+			});
+
+			REQUIRE(TraceEventType::Resolution == events.front().type);
+			REQUIRE(0 == events.front().depth);
+			REQUIRE(events.end() != creation);
+			REQUIRE(1 == creation->depth);
+		}
+
+		SECTION("WhenResolutionThrows_RecordsFailure")
+		{
+			container.BindFunction<int>([](ResolutionContext&) -> int { throw SerumException("Failed."); });
+
+			REQUIRE_THROWS_AS(container.Get<int>(), SerumException);
+			REQUIRE(1 == recorder->GetEvents().size());
+			REQUIRE_FALSE(recorder->GetEvents()[0].succeeded);
+		}
+
+		SECTION("WhenResolvedOnSeveralThreads_RecordsEachThread")
+		{
+			container.BindConstant<int>(1);
+
+			(void)container.Get<int>();
+			auto thread = std::thread([&container] { (void)container.Get<int>(); });
+			thread.join();
+
+			auto const events = recorder->GetEvents();
+
+			REQUIRE(2 == events.size());
+			REQUIRE(events[0].threadIndex != events[1].threadIndex);
+		}
+
+		SECTION("WhenCleared_IsEmpty")
+		{
+			container.BindConstant<int>(1);
+
+			(void)container.Get<int>();
+			recorder->Clear();
+
+			REQUIRE(recorder->GetEvents().empty());
+		}
+	}
+
+	TEST_CASE("TraceRecorder_ToChromeTrace")
+	{
+		auto recorder = std::make_shared<TraceRecorder>();
+		auto container = SerumContainer();
+		container.SetObserver(recorder);
+
+		SECTION("WhenNothingIsResolved_WritesEmptyTrace")
+		{
+			REQUIRE("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n" == recorder->ToChromeTrace());
+		}
+
+		SECTION("WhenBindingIsResolved_WritesCompleteEvent")
+		{
+			container.BindConstant<int>(1, "na\"me");
+
+			(void)container.Get<int>("na\"me");
+
+			auto const trace = recorder->ToChromeTrace();
+
+			REQUIRE(std::string::npos != trace.find("\"ph\":\"M\""));
+			REQUIRE(std::string::npos != trace.find("\"ph\":\"X\""));
+			REQUIRE(std::string::npos != trace.find("\"cat\":\"resolve\""));
+			REQUIRE(std::string::npos != trace.find("na\\\"me"));
+			REQUIRE(std::string::npos != trace.find("\"succeeded\":true"));
+		}
+	}
+}
+
+#endif // SERUM_HAS_OBSERVERS
@@ -0,0 +1,117 @@
+/// @file ResolutionContextTests.cpp
+/// Unit tests for the ResolutionContext type.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+namespace Serum::ResolutionContextTests
+{
+#if SERUM_RESOLUTION_TRACKING == SERUM_RESOLUTION_TRACKING_FULL
+	template <std::size_t Depth>
+	struct Chain final
+	{
+		int value = 0;
+	};
+
+	template <std::size_t Depth, std::size_t MaxDepth>
+	void BindChain(SerumContainer& container, std::vector<std::size_t>& observedDepths)
+	{
+		if constexpr (Depth < MaxDepth)
+		{
+			container.BindFunction<Chain<Depth>>([&container, &observedDepths](ResolutionContext& context)
+			{
+				observedDepths.push_back(context.GetResolutionDepth());
+				return Chain<Depth>{ container.Get<Chain<Depth + 1>>(context).value + 1 };
+			});
+
+			BindChain<Depth + 1, MaxDepth>(container, observedDepths);
+		}
+		else
+		{
+			container.BindFunction<Chain<Depth>>([](ResolutionContext& context)
+			{
+				REQUIRE(context.ResolutionPathContainsType(typeid(Chain<0>)));
+				REQUIRE(context.ResolutionPathContainsKey(Bindings::BindingKey(typeid(Chain<Depth - 1>), "")));
+				REQUIRE(context.GetRequestingBinding() == Bindings::BindingKey(typeid(Chain<Depth>), ""));
+				return Chain<Depth>{ 0 };
+			});
+		}
+	}
+
+#endif
+
+	TEST_CASE("ResolutionContext_WhenPathIsEmpty")
+	{
+		auto const context = ResolutionContext();
+
+		SECTION("GetRequestingBinding_Throws")
+		{
+			REQUIRE_THROWS_AS(context.GetRequestingBinding(), SerumException);
+		}
+
+		SECTION("ResolutionPathContainsType_ReturnsFalse")
+		{
+			REQUIRE_FALSE(context.ResolutionPathContainsType(typeid(int)));
+		}
+
+		SECTION("ResolutionPathContainsKey_ReturnsFalse")
+		{
+			REQUIRE_FALSE(context.ResolutionPathContainsKey(Bindings::BindingKey(typeid(int), "never-bound")));
+		}
+	}
+
+#if SERUM_RESOLUTION_TRACKING == SERUM_RESOLUTION_TRACKING_FULL
+	TEST_CASE("ResolutionContext_NamedBindings")
+	{
+		auto container = SerumContainer();
+		auto containsNamedKey = false;
+		auto containsUnnamedType = true;
+		container.BindFunction<int>([&](ResolutionContext& context)
+		{
+			containsNamedKey = context.ResolutionPathContainsKey(Bindings::BindingKey(typeid(int), "named"));
+			containsUnnamedType = context.ResolutionPathContainsType(typeid(int));
+			return 1;
+		}, "named");
+
+		(void)container.Get<int>("named");
+
+		REQUIRE(containsNamedKey);
+		REQUIRE_FALSE(containsUnnamedType);
+	}
+
+	TEST_CASE("ResolutionContext_WhenContainerIsCopied_ReportsCopiedBindingNames")
+	{
+		auto requestingBinding = std::optional<Bindings::BindingKey>();
+		auto copy = std::optional<SerumContainer>();
+
+		{
+			auto original = SerumContainer();
+			original.BindFunction<int>([&](ResolutionContext& context)
+			{
+				requestingBinding = context.GetRequestingBinding();
+				return context.ResolutionPathContainsKey(Bindings::BindingKey(typeid(int), "copied")) ? 1 : 0;
+			}, "copied");
+
+			copy.emplace(original);
+		}
+
+		REQUIRE(1 == copy->Get<int>("copied"));
+		REQUIRE(Bindings::BindingKey(typeid(int), "copied") == *requestingBinding);
+	}
+
+	TEST_CASE("ResolutionContext_WhenPathIsDeeperThanInlineCapacity_TracksEveryBinding")
+	{
+		constexpr auto depth = std::size_t(40);
+		auto container = SerumContainer();
+		auto observedDepths = std::vector<std::size_t>();
+		BindChain<0, depth>(container, observedDepths);
+
+		auto const result = container.Get<Chain<0>>();
+
+		REQUIRE(depth == static_cast<std::size_t>(result.value));
+		REQUIRE(depth == observedDepths.size());
+		REQUIRE(1 == observedDepths.front());
+		REQUIRE(depth == observedDepths.back());
+	}
+#endif
+}
@@ -5,10 +5,142 @@
 #include "Serum.Tests/TestType.hpp"
 #include "Serum.Tests/TestSerumConstructableType.hpp"
 #include "Serum.Tests/TestResolver.hpp"
+#include "Serum.Tests/CopyCountingType.hpp"
 #include "Serum/Serum.hpp"
 
+#include <thread>
+
 namespace Serum::SerumContainerTests
 {
+	struct CyclicB;
+
+	struct CyclicA final
+	{
+		static CyclicA* SerumConstructor(SerumContainer& container, ResolutionContext& resolutionContext);
+	};
+
+	struct CyclicB final
+	{
+		static CyclicB* SerumConstructor(SerumContainer& container, ResolutionContext& resolutionContext)
+		{
+			(void)container.Get<std::shared_ptr<CyclicA>>(resolutionContext);
+			return new CyclicB();
+		}
+	};
+
+	CyclicA* CyclicA::SerumConstructor(SerumContainer& container, ResolutionContext& resolutionContext)
+	{
+		(void)container.Get<CyclicB>(resolutionContext);
+		return new CyclicA();
+	}
+
+	struct InjectedService final
+	{
+		using SerumDependencies = Dependencies<int, std::shared_ptr<TestType>>;
+
+		inline static int numberOfCopies = 0;
+
+		int number;
+		std::shared_ptr<TestType> testType;
+
+		InjectedService(int number, std::shared_ptr<TestType> testType)
+			: number(number),
+			  testType(std::move(testType))
+		{
+		}
+
+		InjectedService(InjectedService const& other)
+			: number(other.number),
+			  testType(other.testType)
+		{
+			++numberOfCopies;
+		}
+
+		InjectedService(InjectedService&&) = default;
+
+		InjectedService& operator=(InjectedService const&) = default;
+
+		InjectedService& operator=(InjectedService&&) = default;
+	};
+
+	struct InjectedServiceWithOrderedDependencies final
+	{
+		using SerumDependencies = Dependencies<int, double, std::string>;
+
+		InjectedServiceWithOrderedDependencies(int, double, std::string const&)
+		{
+		}
+	};
+
+	struct InjectedServiceWithSerumConstructor final
+	{
+		using SerumDependencies = Dependencies<int>;
+
+		int number;
+
+		explicit InjectedServiceWithSerumConstructor(int number)
+			: number(number)
+		{
+		}
+
+		static InjectedServiceWithSerumConstructor* SerumConstructor(SerumContainer&, ResolutionContext&)
+		{
+			return new InjectedServiceWithSerumConstructor(-1);
+		}
+	};
+
+	struct CopyCountingFunction final
+	{
+		inline static int numberOfCopies = 0;
+
+		CopyCountingFunction() = default;
+
+		CopyCountingFunction(CopyCountingFunction const&)
+		{
+			++numberOfCopies;
+		}
+
+		CopyCountingFunction(CopyCountingFunction&&) noexcept = default;
+
+		int operator()(ResolutionContext&) const
+		{
+			return 4;
+		}
+	};
+
+	struct DiamondLeaf final
+	{
+		inline static int numberOfConstructions = 0;
+
+		DiamondLeaf()
+		{
+			++numberOfConstructions;
+		}
+	};
+
+	template <int Side>
+	struct DiamondSide final
+	{
+		std::shared_ptr<DiamondLeaf> leaf = nullptr;
+
+		static DiamondSide* SerumConstructor(SerumContainer& container, ResolutionContext& resolutionContext)
+		{
+			return new DiamondSide{ container.GetSharedPointer<DiamondLeaf>(resolutionContext) };
+		}
+	};
+
+	struct DiamondRoot final
+	{
+		DiamondSide<0> left{};
+		DiamondSide<1> right{};
+
+		static DiamondRoot* SerumConstructor(SerumContainer& container, ResolutionContext& resolutionContext)
+		{
+			auto [left, right] = container.GetMany<DiamondSide<0>, DiamondSide<1>>(resolutionContext);
+			return new DiamondRoot{ left, right };
+		}
+	};
+
 	TEST_CASE("SerumContainer_GetNumberOfBindings")
 	{
 		constexpr auto expected = 4;
@@ -49,6 +181,141 @@ namespace Serum::SerumContainerTests
 		}
 	}
 
+	TEST_CASE("SerumContainer_GetMany")
+	{
+		auto container = SerumContainer().BindConstant<int>(4)
+										 .BindConstant<std::string>(std::string("test"))
+										 .BindConstant<std::string>(std::string("named"), "name")
+										 .BindSingletonSharedPointer<TestType>();
+
+		SECTION("WhenBindingsExist_ReturnsResolvedServicesInOrder")
+		{
+			auto const [integer, string, pointer] = container.GetMany<int, std::string, std::shared_ptr<TestType>>();
+
+			REQUIRE(4 == integer);
+			REQUIRE("test" == string);
+			REQUIRE(TestType() == *pointer);
+		}
+
+		SECTION("WhenNamesAreGiven_ResolvesNamedBindings")
+		{
+			auto const [integer, string] = container.GetMany<int, std::string>({ "", "name" });
+
+			REQUIRE(4 == integer);
+			REQUIRE("named" == string);
+		}
+
+		SECTION("WhenSingletonIsRequestedTwice_ReturnsSameInstance")
+		{
+			auto const [first, second] = container.GetMany<std::shared_ptr<TestType>, std::shared_ptr<TestType>>();
+
+			REQUIRE(first == second);
+			REQUIRE(first == container.GetSharedPointer<TestType>());
+		}
+
+		SECTION("WhenAnyBindingDoesNotExist_ThrowsBeforeResolving")
+		{
+			auto numberOfResolutions = 0;
+			container.BindFunction<double>([&](ResolutionContext&) { return ++numberOfResolutions; });
+
+			REQUIRE_THROWS_AS((container.GetMany<double, float>()), SerumException);
+			REQUIRE(0 == numberOfResolutions);
+		}
+
+		SECTION("AllServicesShareTheResolutionContext")
+		{
+			auto context = ResolutionContext();
+			auto contexts = std::vector<ResolutionContext*>();
+			container.BindFunction<double>([&](ResolutionContext& c) { contexts.push_back(&c); return 1.0; })
+					 .BindFunction<float>([&](ResolutionContext& c) { contexts.push_back(&c); return 1.f; });
+
+			(void)container.GetMany<double, float>(context);
+
+			REQUIRE(2 == contexts.size());
+			REQUIRE(&context == contexts[0]);
+			REQUIRE(&context == contexts[1]);
+		}
+	}
+
+#if SERUM_RESOLUTION_TRACKING != SERUM_RESOLUTION_TRACKING_NONE
+	TEST_CASE("SerumContainer_CircularDependencies")
+	{
+#if SERUM_RESOLUTION_TRACKING == SERUM_RESOLUTION_TRACKING_FULL
+		SECTION("WhenBindingsFormACycle_ThrowsWithFullCycle")
+		{
+			auto container = SerumContainer();
+			container.BindSharedPointer<CyclicA>()
+					 .BindToSelf<CyclicB>();
+			auto const keyA = Bindings::BindingKey(typeid(std::shared_ptr<CyclicA>), "");
+			auto const keyB = Bindings::BindingKey(typeid(CyclicB), "");
+
+			try
+			{
+				(void)container.GetSharedPointer<CyclicA>();
+				FAIL("Expected a CircularDependencyException.");
+			}
+			catch (CircularDependencyException const& exception)
+			{
+				auto const& cycle = exception.GetCycle();
+
+				REQUIRE(3 == cycle.size());
+				REQUIRE(keyA == cycle[0]);
+				REQUIRE(keyB == cycle[1]);
+				REQUIRE(keyA == cycle[2]);
+			}
+		}
+#else
+		SECTION("WhenBindingsFormACycle_ThrowsWithRepeatedBinding")
+		{
+			auto container = SerumContainer();
+			container.BindSharedPointer<CyclicA>()
+					 .BindToSelf<CyclicB>();
+
+			try
+			{
+				(void)container.GetSharedPointer<CyclicA>();
+				FAIL("Expected a CircularDependencyException.");
+			}
+			catch (CircularDependencyException const& exception)
+			{
+				REQUIRE(1 == exception.GetCycle().size());
+				REQUIRE(Bindings::BindingKey(typeid(std::shared_ptr<CyclicA>), "") == exception.GetCycle().front());
+			}
+		}
+#endif
+
+		SECTION("WhenBindingRequestsItself_ThrowsSerumException")
+		{
+			auto container = SerumContainer();
+			container.BindFunction<int>([&container](ResolutionContext& context) { return container.Get<int>(context); });
+
+			REQUIRE_THROWS_AS(container.Get<int>(), SerumException);
+		}
+
+		SECTION("WhenCycleIsDetected_ContextCanBeReused")
+		{
+			auto container = SerumContainer();
+			auto context = ResolutionContext();
+			container.BindFunction<int>([&container](ResolutionContext& c) { return container.Get<int>(c); })
+					 .BindConstant<double>(1.0);
+
+			REQUIRE_THROWS_AS(container.Get<int>(context), CircularDependencyException);
+			REQUIRE(0 == context.GetResolutionDepth());
+			REQUIRE(1.0 == container.Get<double>(context));
+		}
+
+		SECTION("WhenSameBindingIsResolvedRepeatedly_DoesNotThrow")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<int>(1);
+			auto context = ResolutionContext();
+
+			REQUIRE(1 == container.Get<int>(context));
+			REQUIRE(1 == container.Get<int>(context));
+		}
+	}
+#endif
+
 	TEST_CASE("SerumContainer_BindConstant")
 	{
 		SECTION("WhenBindingDoesNotExist_CorrectlyBinds")
@@ -69,6 +336,123 @@ namespace Serum::SerumContainerTests
 
 			REQUIRE_THROWS(container.BindConstant<int>(3));
 		}
+
+		SECTION("WhenResolutionTypeDiffers_ConvertsValue")
+		{
+			auto container = SerumContainer();
+
+			container.BindConstant<double, int>(3);
+
+			REQUIRE(3.0 == container.Get<double>());
+		}
+
+		SECTION("WhenValueIsMoved_IsNeverCopiedByGetRef")
+		{
+			auto container = SerumContainer();
+			CopyCountingType::numberOfCopies = 0;
+
+			container.BindConstant<CopyCountingType>(CopyCountingType(4));
+
+			REQUIRE(4 == container.GetRef<CopyCountingType>().value);
+			REQUIRE(&container.GetRef<CopyCountingType>() == &container.GetRef<CopyCountingType>());
+			REQUIRE(0 == CopyCountingType::numberOfCopies);
+		}
+
+		SECTION("WhenValueIsCopied_IsCopiedOnceWhenBound")
+		{
+			auto container = SerumContainer();
+			auto const value = CopyCountingType(4);
+			CopyCountingType::numberOfCopies = 0;
+
+			container.BindConstant<CopyCountingType>(value);
+			(void)container.GetRef<CopyCountingType>();
+
+			REQUIRE(1 == CopyCountingType::numberOfCopies);
+		}
+
+		SECTION("WhenResolvedWithGet_IsCopiedOnce")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<CopyCountingType>(CopyCountingType(4));
+			CopyCountingType::numberOfCopies = 0;
+
+			REQUIRE(4 == container.Get<CopyCountingType>().value);
+			REQUIRE(1 == CopyCountingType::numberOfCopies);
+		}
+	}
+
+	TEST_CASE("SerumContainer_BindInstance")
+	{
+		SECTION("WhenBindingDoesNotExist_BindsWithoutCopying")
+		{
+			auto container = SerumContainer();
+			auto instance = CopyCountingType(4);
+			CopyCountingType::numberOfCopies = 0;
+
+			container.BindInstance(instance);
+
+			REQUIRE(&instance == &container.GetRef<CopyCountingType>());
+			REQUIRE(0 == CopyCountingType::numberOfCopies);
+		}
+
+		SECTION("WhenResolvedWithGet_ReturnsCopyOfCurrentValue")
+		{
+			auto container = SerumContainer();
+			auto instance = CopyCountingType(4);
+			container.BindInstance(instance, "named");
+
+			instance.value = 5;
+
+			REQUIRE(5 == container.Get<CopyCountingType>("named").value);
+		}
+
+		SECTION("WhenTypeIsNotCopyConstructible_CanBeResolvedByReference")
+		{
+			auto container = SerumContainer();
+			auto instance = std::mutex();
+
+			container.BindInstance(instance);
+
+			REQUIRE(&instance == &container.GetRef<std::mutex>());
+		}
+
+		SECTION("WhenInstanceIsConst_BindsUnqualifiedType")
+		{
+			auto container = SerumContainer();
+			auto const instance = CopyCountingType(4);
+
+			container.BindInstance(instance);
+
+			REQUIRE(container.HasBinding<CopyCountingType>());
+			REQUIRE(&instance == &container.GetRef<CopyCountingType>());
+			REQUIRE(4 == container.Get<CopyCountingType>().value);
+		}
+
+		SECTION("WhenBindingExists_Throws")
+		{
+			auto container = SerumContainer();
+			auto instance = 4;
+
+			container.BindInstance(instance);
+
+			REQUIRE_THROWS(container.BindInstance(instance));
+		}
+	}
+
+	TEST_CASE("SerumContainer_GetRef")
+	{
+		auto container = SerumContainer();
+		container.BindFunction<int>([](ResolutionContext&) { return 4; });
+
+		SECTION("WhenBindingIsNotConstantOrInstance_Throws")
+		{
+			REQUIRE_THROWS_AS(container.GetRef<int>(), SerumException);
+		}
+
+		SECTION("WhenBindingDoesNotExist_Throws")
+		{
+			REQUIRE_THROWS_AS(container.GetRef<double>(), SerumException);
+		}
 	}
 
 	TEST_CASE("SerumContainer_BindFunction")
@@ -91,6 +475,28 @@ namespace Serum::SerumContainerTests
 
 			REQUIRE_THROWS(container.BindFunction<int>([](ResolutionContext&) { return 7; }));
 		}
+
+		SECTION("WhenResolved_FunctionIsNotCopied")
+		{
+			auto container = SerumContainer();
+			container.BindFunction<int>(CopyCountingFunction());
+			CopyCountingFunction::numberOfCopies = 0;
+
+			CHECK(4 == container.Get<int>());
+			CHECK(4 == container.Get<int>());
+
+			REQUIRE(0 == CopyCountingFunction::numberOfCopies);
+		}
+
+		SECTION("WhenBoundWithStdFunction_CorrectlyBinds")
+		{
+			auto container = SerumContainer();
+			auto const function = Bindings::ResolutionFunction<int>([](ResolutionContext&) { return 4; });
+
+			container.BindFunction<int>(function);
+
+			REQUIRE(4 == container.Get<int>());
+		}
 	}
 
 	TEST_CASE("SerumContainer_BindResolver")
@@ -291,6 +697,63 @@ namespace Serum::SerumContainerTests
 		}
 	}
 
+	TEST_CASE("SerumContainer_BindPerResolutionSharedPointer")
+	{
+		auto container = SerumContainer();
+		container.BindToSelf<DiamondRoot>()
+				 .BindToSelf<DiamondSide<0>>()
+				 .BindToSelf<DiamondSide<1>>()
+				 .BindPerResolutionSharedPointer<DiamondLeaf>();
+		DiamondLeaf::numberOfConstructions = 0;
+
+		SECTION("WithinOneResolution_SharedDependencyIsConstructedOnce")
+		{
+			auto const root = container.Get<DiamondRoot>();
+
+			REQUIRE(1 == DiamondLeaf::numberOfConstructions);
+			REQUIRE(root.left.leaf == root.right.leaf);
+		}
+
+		SECTION("AcrossResolutions_SharedDependencyIsConstructedEachTime")
+		{
+			auto const first = container.Get<DiamondRoot>();
+			auto const second = container.Get<DiamondRoot>();
+
+			REQUIRE(2 == DiamondLeaf::numberOfConstructions);
+			REQUIRE(first.left.leaf != second.left.leaf);
+		}
+
+		SECTION("WhenBindingExists_Throws")
+		{
+			REQUIRE_THROWS(container.BindPerResolutionSharedPointer<DiamondLeaf>());
+		}
+	}
+
+	TEST_CASE("SerumContainer_BindPerResolutionToSelf")
+	{
+		SECTION("WhenRequestedTwiceInOneContext_ConstructsOnce")
+		{
+			auto container = SerumContainer();
+			container.BindPerResolutionToSelf<DiamondLeaf>();
+			auto context = ResolutionContext();
+			DiamondLeaf::numberOfConstructions = 0;
+
+			(void)container.Get<DiamondLeaf>(context);
+			(void)container.Get<DiamondLeaf>(context);
+
+			REQUIRE(1 == DiamondLeaf::numberOfConstructions);
+		}
+
+		SECTION("WhenBindingExists_Throws")
+		{
+			auto container = SerumContainer();
+
+			container.BindPerResolutionToSelf<TestType>();
+
+			REQUIRE_THROWS(container.BindPerResolutionToSelf<TestType>());
+		}
+	}
+
 	TEST_CASE("SerumContainer_BindingMethods_CanBeChained")
 	{
 		auto container = SerumContainer()
@@ -301,8 +764,209 @@ namespace Serum::SerumContainerTests
 								.BindRawPointer<double>()
 								.BindSharedPointer<float>()
 								.BindSingletonRawPointer<double>("singleton")
-								.BindSingletonSharedPointer<float>("singleton");
+								.BindSingletonSharedPointer<float>("singleton")
+								.BindPerResolutionToSelf<TestType>("per-resolution")
+								.BindPerResolutionSharedPointer<TestType>("per-resolution");
+
+		REQUIRE(10 == container.GetNumberOfBindings());
+	}
 
-		REQUIRE(8 == container.GetNumberOfBindings());
+	TEST_CASE("SerumContainer_WhenCopied_BindingsAreCloned")
+	{
+		auto container = SerumContainer();
+		container.BindSingletonSharedPointer<TestType>();
+		auto const original = container.GetSharedPointer<TestType>();
+
+		auto copy = container;
+
+		REQUIRE(original == copy.GetSharedPointer<TestType>());
+		REQUIRE(1 == copy.GetNumberOfBindings());
+	}
+
+	TEST_CASE("SerumContainer_ConstructorInjection")
+	{
+		auto container = SerumContainer();
+		container.BindConstant<int>(42)
+				 .BindSingletonSharedPointer<TestType>();
+		auto const testType = container.GetSharedPointer<TestType>();
+
+		SECTION("BindToSelf_InjectsDeclaredDependencies")
+		{
+			container.BindToSelf<InjectedService>();
+			InjectedService::numberOfCopies = 0;
+
+			auto const service = container.Get<InjectedService>();
+
+			REQUIRE(42 == service.number);
+			REQUIRE(testType == service.testType);
+			REQUIRE(0 == InjectedService::numberOfCopies);
+		}
+
+		SECTION("BindRawPointer_InjectsDeclaredDependencies")
+		{
+			container.BindRawPointer<InjectedService>();
+
+			auto const service = std::unique_ptr<InjectedService>(container.Get<InjectedService*>());
+
+			REQUIRE(42 == service->number);
+			REQUIRE(testType == service->testType);
+		}
+
+		SECTION("BindSharedPointer_InjectsDeclaredDependencies")
+		{
+			container.BindSharedPointer<InjectedService>();
+			InjectedService::numberOfCopies = 0;
+
+			auto const service = container.GetSharedPointer<InjectedService>();
+
+			REQUIRE(42 == service->number);
+			REQUIRE(testType == service->testType);
+			REQUIRE(0 == InjectedService::numberOfCopies);
+		}
+
+		SECTION("BindSingletonSharedPointer_InjectsDeclaredDependencies")
+		{
+			container.BindSingletonSharedPointer<InjectedService>();
+
+			REQUIRE(42 == container.GetSharedPointer<InjectedService>()->number);
+			REQUIRE(container.GetSharedPointer<InjectedService>() == container.GetSharedPointer<InjectedService>());
+		}
+
+		SECTION("ResolvesDependenciesInDeclaredOrder")
+		{
+			auto resolutionOrder = std::vector<std::string>();
+			auto orderedContainer = SerumContainer();
+			orderedContainer.BindFunction<int>([&resolutionOrder](ResolutionContext&) { resolutionOrder.emplace_back("int"); return 1; })
+							.BindFunction<double>([&resolutionOrder](ResolutionContext&) { resolutionOrder.emplace_back("double"); return 2.0; })
+							.BindFunction<std::string>([&resolutionOrder](ResolutionContext&) { resolutionOrder.emplace_back("string"); return std::string("3"); })
+							.BindToSelf<InjectedServiceWithOrderedDependencies>()
+							.BindRawPointer<InjectedServiceWithOrderedDependencies>()
+							.BindSharedPointer<InjectedServiceWithOrderedDependencies>();
+			auto const expectedOrder = std::vector<std::string>({ "int", "double", "string" });
+
+			(void)orderedContainer.Get<InjectedServiceWithOrderedDependencies>();
+			REQUIRE(expectedOrder == resolutionOrder);
+
+			resolutionOrder.clear();
+			delete orderedContainer.Get<InjectedServiceWithOrderedDependencies*>();
+			REQUIRE(expectedOrder == resolutionOrder);
+
+			resolutionOrder.clear();
+			(void)orderedContainer.GetSharedPointer<InjectedServiceWithOrderedDependencies>();
+			REQUIRE(expectedOrder == resolutionOrder);
+		}
+
+		SECTION("WhenDependencyIsNotBound_Throws")
+		{
+			auto emptyContainer = SerumContainer();
+			emptyContainer.BindToSelf<InjectedService>();
+
+			REQUIRE_THROWS_AS(emptyContainer.Get<InjectedService>(), SerumException);
+		}
+
+		SECTION("WhenTypeHasSerumConstructor_SerumConstructorIsUsed")
+		{
+			container.BindToSelf<InjectedServiceWithSerumConstructor>();
+
+			REQUIRE(-1 == container.Get<InjectedServiceWithSerumConstructor>().number);
+		}
+	}
+
+#ifdef SERUM_ENABLE_METRICS
+	[[nodiscard]] Metrics::BindingStatistics FindStatistics(SerumContainer const& container, Bindings::BindingKey const& key)
+	{
+		for (auto const& statistics : container.GetStatistics())
+		{
+			if (statistics.key == key)
+			{
+				return statistics;
+			}
+		}
+
+		throw SerumException("No statistics for binding.");
+	}
+
+	TEST_CASE("SerumContainer_GetStatistics")
+	{
+		SECTION("ReturnsStatisticsForEachBinding")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<int>(1)
+					 .BindConstant<int>(2, "two");
+
+			REQUIRE(2 == container.GetStatistics().size());
+		}
+
+		SECTION("WhenBindingIsResolved_CountsResolutions")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<int>(1);
+
+			for (auto i = 0; i < 3; ++i)
+			{
+				(void)container.Get<int>();
+			}
+
+			auto const statistics = FindStatistics(container, Bindings::BindingKey(typeid(int), ""));
+
+			REQUIRE(3 == statistics.resolveCount);
+			REQUIRE(0 == statistics.failureCount);
+			REQUIRE(3 == statistics.latency.GetCount());
+			REQUIRE(statistics.exclusiveTime <= statistics.inclusiveTime);
+		}
+
+		SECTION("WhenResolutionThrows_CountsFailure")
+		{
+			auto container = SerumContainer();
+			container.BindFunction<int>([](ResolutionContext&) -> int { throw SerumException("Failed."); });
+
+			REQUIRE_THROWS_AS(container.Get<int>(), SerumException);
+
+			auto const statistics = FindStatistics(container, Bindings::BindingKey(typeid(int), ""));
+
+			REQUIRE(1 == statistics.resolveCount);
+			REQUIRE(1 == statistics.failureCount);
+		}
+
+		SECTION("WhenBindingHasDependencies_ExclusiveTimeExcludesDependencies")
+		{
+			constexpr auto dependencyTime = std::chrono::milliseconds(5);
+			auto container = SerumContainer();
+			container.BindFunction<int>([dependencyTime](ResolutionContext&)
+					 {
+						 std::this_thread::sleep_for(dependencyTime);
+						 return 1;
+					 })
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 });
+
+			(void)container.Get<double>();
+
+			auto const statistics = FindStatistics(container, Bindings::BindingKey(typeid(double), ""));
+
+			REQUIRE(statistics.inclusiveTime >= dependencyTime);
+			REQUIRE(statistics.exclusiveTime < dependencyTime);
+		}
+
+		SECTION("WhenBindingIsSingleton_CountsHits")
+		{
+			auto container = SerumContainer();
+			container.BindSingletonSharedPointer<TestType>();
+
+			for (auto i = 0; i < 4; ++i)
+			{
+				(void)container.GetSharedPointer<TestType>();
+			}
+
+			auto const statistics = FindStatistics(container, Bindings::BindingKey(typeid(std::shared_ptr<TestType>), ""));
+
+			REQUIRE(Bindings::BindingType::Singleton == statistics.bindingType);
+			REQUIRE(4 == statistics.resolveCount);
+			REQUIRE(3 == statistics.singletonHitCount);
+			REQUIRE(0.75 == statistics.GetSingletonHitRate());
+		}
 	}
+#endif
 }
@@ -0,0 +1,158 @@
+/// @file SerumObserverTests.cpp
+/// Unit tests for observing resolutions with the SerumObserver type.
+
+#include "catch.hpp"
+#include "Serum.Tests/TestType.hpp"
+#include "Serum/Serum.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <vector>
+
+namespace Serum::SerumObserverTests
+{
+	struct ObservedEvent final
+	{
+		std::string name;
+		Bindings::BindingKey key;
+		std::size_t depth;
+		bool succeeded;
+	};
+
+	class RecordingObserver final : public SerumObserver
+	{
+		public:
+			std::vector<ObservedEvent> events{};
+
+			void OnResolveBegin(Bindings::BindingKey const& key, std::size_t const depth) override
+			{
+				events.push_back(ObservedEvent{ "Begin", key, depth, true });
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds, bool const succeeded) override
+			{
+				events.push_back(ObservedEvent{ "End", key, 0, succeeded });
+			}
+
+			void OnSingletonCreated(Bindings::BindingKey const& key, std::chrono::nanoseconds) override
+			{
+				events.push_back(ObservedEvent{ "SingletonCreated", key, 0, true });
+			}
+	};
+
+	TEST_CASE("SerumContainer_SetObserver")
+	{
+		auto const intKey = Bindings::BindingKey(typeid(int), "");
+		auto const doubleKey = Bindings::BindingKey(typeid(double), "");
+		auto observer = std::make_shared<RecordingObserver>();
+
+		SECTION("WhenNoObserverIsSet_GetObserverIsNull")
+		{
+			auto container = SerumContainer();
+
+			REQUIRE(nullptr == container.GetObserver());
+		}
+
+		SECTION("WhenBindingIsResolved_NotifiesBeginAndEnd")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<int>(1)
+					 .SetObserver(observer);
+
+			REQUIRE(1 == container.Get<int>());
+			REQUIRE(observer == container.GetObserver());
+			REQUIRE(2 == observer->events.size());
+			REQUIRE("Begin" == observer->events[0].name);
+			REQUIRE(intKey == observer->events[0].key);
+			REQUIRE(0 == observer->events[0].depth);
+			REQUIRE("End" == observer->events[1].name);
+			REQUIRE(observer->events[1].succeeded);
+		}
+
+		SECTION("WhenBindingHasDependencies_NotifiesNestedDepth")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<int>(1)
+					 .BindFunction<double>([&container](ResolutionContext& context)
+					 {
+						 return static_cast<double>(container.Get<int>(context));
+					 })
+					 .SetObserver(observer);
+
+			(void)container.Get<double>();
+
+			REQUIRE(4 == observer->events.size());
+			REQUIRE(doubleKey == observer->events[0].key);
+			REQUIRE(0 == observer->events[0].depth);
+			REQUIRE(intKey == observer->events[1].key);
+			REQUIRE(1 == observer->events[1].depth);
+			REQUIRE(intKey == observer->events[2].key);
+			REQUIRE("End" == observer->events[2].name);
+			REQUIRE(doubleKey == observer->events[3].key);
+			REQUIRE("End" == observer->events[3].name);
+		}
+
+		SECTION("WhenResolutionThrows_NotifiesFailure")
+		{
+			auto container = SerumContainer();
+			container.BindFunction<int>([](ResolutionContext&) -> int { throw SerumException("Failed."); })
+					 .SetObserver(observer);
+
+			REQUIRE_THROWS_AS(container.Get<int>(), SerumException);
+			REQUIRE(2 == observer->events.size());
+			REQUIRE("End" == observer->events[1].name);
+			REQUIRE_FALSE(observer->events[1].succeeded);
+		}
+
+		SECTION("WhenSingletonIsResolved_NotifiesCreationOnce")
+		{
+			auto container = SerumContainer();
+			container.BindSingletonSharedPointer<TestType>()
+					 .SetObserver(observer);
+
+			(void)container.Get<std::shared_ptr<TestType>>();
+			(void)container.Get<std::shared_ptr<TestType>>();
+
+			auto numberOfCreations = std::size_t(0);
+			for (auto const& event : observer->events)
+			{
+				if (event.name == "SingletonCreated")
+				{
+					++numberOfCreations;
+				}
+			}
+
+			REQUIRE(1 == numberOfCreations);
+		}
+
+		SECTION("WhenObserverIsRemoved_StopsNotifying")
+		{
+			auto container = SerumContainer();
+			container.BindConstant<int>(1)
+					 .SetObserver(observer)
+					 .SetObserver(nullptr);
+
+			(void)container.Get<int>();
+
+			REQUIRE(observer->events.empty());
+		}
+
+		SECTION("WhenContextHasObserver_ContextObserverIsUsed")
+		{
+			auto contextObserver = RecordingObserver();
+			auto context = ResolutionContext();
+			context.SetObserver(&contextObserver);
+
+			auto container = SerumContainer();
+			container.BindConstant<int>(1)
+					 .SetObserver(observer);
+
+			(void)container.Get<int>(context);
+
+			REQUIRE(observer->events.empty());
+			REQUIRE(2 == contextObserver.events.size());
+		}
+	}
+}
+
+#endif // SERUM_HAS_OBSERVERS
@@ -0,0 +1,136 @@
+/// @file StaticDependencyGraphTests.cpp
+/// Unit tests for the compile-time analysis of static binding dependencies.
+
+#include "catch.hpp"
+#include "Serum/Serum.hpp"
+
+namespace Serum::Internal::StaticDependencyGraphTests
+{
+	struct Leaf final {};
+
+	struct Middle final
+	{
+		using SerumDependencies = Dependencies<Leaf>;
+	};
+
+	struct Root final
+	{
+		using SerumDependencies = Dependencies<Middle, std::shared_ptr<Leaf>>;
+	};
+
+	struct SelfDependent final
+	{
+		using SerumDependencies = Dependencies<SelfDependent>;
+	};
+
+	struct CyclicB;
+
+	struct CyclicA final
+	{
+		using SerumDependencies = Dependencies<CyclicB>;
+	};
+
+	struct CyclicB final
+	{
+		using SerumDependencies = Dependencies<CyclicA>;
+	};
+
+	struct Constructed final
+	{
+		using SerumDependencies = Dependencies<Leaf>;
+
+		static Constructed* SerumConstructor(SerumContainer&, ResolutionContext&)
+		{
+			return new Constructed();
+		}
+	};
+
+	TEST_CASE("StaticDependencyGraph_InitializationOrder")
+	{
+		SECTION("WhenBindingsHaveNoDependencies_OrderIsDeclarationOrder")
+		{
+			using Graph = StaticDependencyGraph<Static::ToSelf<Leaf>, Static::Constant<int>>;
+
+			STATIC_REQUIRE(Graph::IsAcyclic);
+			STATIC_REQUIRE(Graph::AllDependenciesBound);
+			STATIC_REQUIRE(0 == Graph::InitializationOrder.Indices[0]);
+			STATIC_REQUIRE(1 == Graph::InitializationOrder.Indices[1]);
+		}
+
+		SECTION("WhenBindingsHaveDependencies_DependenciesComeFirst")
+		{
+			using Graph = StaticDependencyGraph<
+				Static::ToSelf<Root>,
+				Static::ToSelf<Middle>,
+				Static::Singleton<Static::SharedPointer<Leaf>>,
+				Static::ToSelf<Leaf>>;
+
+			STATIC_REQUIRE(Graph::IsAcyclic);
+			STATIC_REQUIRE(Graph::AllDependenciesBound);
+			STATIC_REQUIRE(4 == Graph::InitializationOrder.Count);
+			STATIC_REQUIRE(2 == Graph::InitializationOrder.Indices[0]);
+			STATIC_REQUIRE(3 == Graph::InitializationOrder.Indices[1]);
+			STATIC_REQUIRE(1 == Graph::InitializationOrder.Indices[2]);
+			STATIC_REQUIRE(0 == Graph::InitializationOrder.Indices[3]);
+		}
+
+		SECTION("WhenGraphIsEmpty_IsValid")
+		{
+			using Graph = StaticDependencyGraph<>;
+
+			STATIC_REQUIRE(Graph::IsAcyclic);
+			STATIC_REQUIRE(Graph::AllDependenciesBound);
+		}
+	}
+
+	TEST_CASE("StaticDependencyGraph_Validation")
+	{
+		SECTION("WhenDependencyIsNotBound_AllDependenciesBoundIsFalse")
+		{
+			using Graph = StaticDependencyGraph<Static::ToSelf<Root>, Static::ToSelf<Middle>, Static::ToSelf<Leaf>>;
+
+			STATIC_REQUIRE_FALSE(Graph::AllDependenciesBound);
+			STATIC_REQUIRE(Graph::IsAcyclic);
+		}
+
+		SECTION("WhenTypeDependsOnItself_IsAcyclicIsFalse")
+		{
+			STATIC_REQUIRE_FALSE(StaticDependencyGraph<Static::ToSelf<SelfDependent>>::IsAcyclic);
+		}
+
+		SECTION("WhenTypesDependOnEachOther_IsAcyclicIsFalse")
+		{
+			using Graph = StaticDependencyGraph<Static::ToSelf<CyclicA>, Static::ToSelf<CyclicB>, Static::ToSelf<Leaf>>;
+
+			STATIC_REQUIRE_FALSE(Graph::IsAcyclic);
+			STATIC_REQUIRE(1 == Graph::InitializationOrder.Count);
+			STATIC_REQUIRE(2 == Graph::InitializationOrder.Indices[0]);
+		}
+
+		SECTION("WhenResolverDeclaresDependencies_DependenciesAreChecked")
+		{
+			struct LeafResolver final : SerumResolver<Middle>
+			{
+				using SerumDependencies = Dependencies<Leaf>;
+
+				Middle Resolve(ResolutionContext&) override
+				{
+					return Middle();
+				}
+			};
+
+			STATIC_REQUIRE_FALSE(StaticDependencyGraph<Static::Resolver<Middle, LeafResolver>>::AllDependenciesBound);
+		}
+
+		SECTION("WhenTypeHasSerumConstructor_DeclaredDependenciesAreNotChecked")
+		{
+			using Graph = StaticDependencyGraph<
+				Static::ToSelf<Constructed>,
+				Static::RawPointer<Constructed>,
+				Static::SharedPointer<Constructed>>;
+
+			STATIC_REQUIRE(Graph::AllDependenciesBound);
+			STATIC_REQUIRE(Graph::IsAcyclic);
+		}
+	}
+}
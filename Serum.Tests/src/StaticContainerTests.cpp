@@ -0,0 +1,195 @@
+/// @file StaticContainerTests.cpp
+/// Unit tests for the StaticContainer type.
+
+#include "catch.hpp"
+#include "Serum.Tests/TestType.hpp"
+#include "Serum.Tests/TestSerumConstructableType.hpp"
+#include "Serum.Tests/TestResolver.hpp"
+#include "Serum/Serum.hpp"
+
+namespace Serum::StaticContainerTests
+{
+	struct InjectedService final
+	{
+		using SerumDependencies = Dependencies<int, std::shared_ptr<TestType>>;
+
+		int number;
+		std::shared_ptr<TestType> testType;
+
+		InjectedService(int number, std::shared_ptr<TestType> testType)
+			: number(number),
+			  testType(std::move(testType))
+		{
+		}
+	};
+
+	TEST_CASE("StaticContainer_Get")
+	{
+		TestType const testValue = { 4, true, "test" };
+		auto numberOfCalls = 0;
+		auto container = StaticContainer(
+			Static::Constant<TestType>(testValue),
+			Static::MakeFunction<int>([&numberOfCalls](ResolutionContext&) { return ++numberOfCalls; }),
+			Static::Resolver<std::string, TestResolver<std::string>>(TestResolver<std::string>("resolved")),
+			Static::ToSelf<double>(),
+			Static::RawPointer<TestType>(),
+			Static::SharedPointer<float>(),
+			Static::Singleton<Static::SharedPointer<TestType>>());
+
+		SECTION("Constant_ReturnsValue")
+		{
+			REQUIRE(testValue == container.Get<TestType>());
+		}
+
+		SECTION("Function_InvokesFunctionEachTime")
+		{
+			REQUIRE(1 == container.Get<int>());
+			REQUIRE(2 == container.Get<int>());
+		}
+
+		SECTION("Resolver_ReturnsResolverResult")
+		{
+			REQUIRE("resolved" == container.Get<std::string>());
+		}
+
+		SECTION("ToSelf_ReturnsDefaultInstance")
+		{
+			REQUIRE(double() == container.Get<double>());
+		}
+
+		SECTION("RawPointer_ReturnsNewInstance")
+		{
+			auto* const pointer = container.Get<TestType*>();
+			CHECK(TestType() == *pointer);
+			delete pointer;
+		}
+
+		SECTION("SharedPointer_ReturnsNewInstanceEachTime")
+		{
+			REQUIRE(container.GetSharedPointer<float>() != container.GetSharedPointer<float>());
+		}
+
+		SECTION("Singleton_ReturnsSameInstance")
+		{
+			REQUIRE(container.GetSharedPointer<TestType>() == container.GetSharedPointer<TestType>());
+		}
+
+		SECTION("WhenNotBoundAndNoFallback_Throws")
+		{
+			REQUIRE_THROWS_AS(container.Get<char>(), SerumException);
+		}
+
+		SECTION("WhenNameIsEmpty_ResolvesStaticBinding")
+		{
+			REQUIRE(container.HasBinding<TestType>(""));
+			REQUIRE(testValue == container.Get<TestType>(""));
+		}
+	}
+
+	TEST_CASE("StaticContainer_Fallback")
+	{
+		auto fallback = SerumContainer();
+		fallback.BindConstant<int>(7)
+				.BindConstant<int>(8, "named");
+		auto container = StaticContainer(
+			fallback,
+			Static::ToSelf<SerumConstructableTestType>(),
+			Static::Constant<double>(1.5));
+
+		SECTION("WhenNotStaticallyBound_ResolvesFromFallback")
+		{
+			REQUIRE(7 == container.Get<int>());
+		}
+
+		SECTION("WhenNamed_ResolvesFromFallback")
+		{
+			REQUIRE(8 == container.Get<int>("named"));
+		}
+
+		SECTION("WhenNameIsEmptyAndStaticallyBound_DoesNotUseFallback")
+		{
+			fallback.BindConstant<double>(2.5);
+
+			REQUIRE(1.5 == container.Get<double>(""));
+			REQUIRE(7 == container.Get<int>(""));
+		}
+
+		SECTION("WhenTypeHasSerumConstructor_ConstructsWithFallback")
+		{
+			REQUIRE(TestType() == container.Get<SerumConstructableTestType>());
+		}
+
+		SECTION("HasBinding_ChecksStaticAndFallbackBindings")
+		{
+			REQUIRE(container.HasBinding<double>());
+			REQUIRE(container.HasBinding<int>());
+			REQUIRE(container.HasBinding<int>("named"));
+			REQUIRE_FALSE(container.HasBinding<double>("named"));
+			REQUIRE_FALSE(container.HasBinding<char>());
+		}
+	}
+
+	TEST_CASE("StaticContainer_IsStaticallyBound")
+	{
+		using Container = StaticContainer<Static::Constant<int>, Static::SharedPointer<TestType>>;
+
+		STATIC_REQUIRE(Container::IsStaticallyBound<int>);
+		STATIC_REQUIRE(0 == Container::GetInitializationOrder()[0]);
+		STATIC_REQUIRE(Container::IsStaticallyBound<std::shared_ptr<TestType>>);
+		STATIC_REQUIRE_FALSE(Container::IsStaticallyBound<TestType>);
+		STATIC_REQUIRE(2 == Container::GetNumberOfStaticBindings());
+	}
+
+	TEST_CASE("StaticContainer_InitializeSingletons")
+	{
+		auto numberOfCalls = 0;
+		auto countCalls = [&numberOfCalls](ResolutionContext&) { return ++numberOfCalls; };
+		auto container = StaticContainer(
+			Static::Singleton(Static::MakeFunction<int>(countCalls)),
+			Static::MakeFunction<long>([&numberOfCalls](ResolutionContext&) { return static_cast<long>(++numberOfCalls); }));
+
+		container.InitializeSingletons();
+
+		SECTION("SingletonsAreResolved")
+		{
+			REQUIRE(1 == numberOfCalls);
+			REQUIRE(1 == container.Get<int>());
+		}
+
+		SECTION("OtherBindingsAreNotResolved")
+		{
+			REQUIRE(2 == container.Get<long>());
+		}
+	}
+
+	TEST_CASE("StaticContainer_ConstructorInjection")
+	{
+		auto container = StaticContainer(
+			Static::ToSelf<InjectedService>(),
+			Static::SharedPointer<InjectedService>(),
+			Static::RawPointer<InjectedService>(),
+			Static::Constant<int>(42),
+			Static::Singleton<Static::SharedPointer<TestType>>());
+		auto const testType = container.GetSharedPointer<TestType>();
+
+		SECTION("ToSelf_InjectsDeclaredDependencies")
+		{
+			auto const service = container.Get<InjectedService>();
+
+			REQUIRE(42 == service.number);
+			REQUIRE(testType == service.testType);
+		}
+
+		SECTION("SharedPointer_InjectsDeclaredDependencies")
+		{
+			REQUIRE(testType == container.GetSharedPointer<InjectedService>()->testType);
+		}
+
+		SECTION("RawPointer_InjectsDeclaredDependencies")
+		{
+			auto const service = std::unique_ptr<InjectedService>(container.Get<InjectedService*>());
+
+			REQUIRE(42 == service->number);
+		}
+	}
+}
@@ -0,0 +1,87 @@
+/// @file Main.cpp
+/// Prints the binding statistics a process publishes with a SharedMemoryExporter, once or at an interval.
+/// Usage: Serum.Tools.MetricsReader <name> [interval in seconds]
+
+#include "Serum/Metrics/SharedMemoryExport.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+
+namespace Serum::Tools::MetricsReader
+{
+	void PrintStatistics(
+		Metrics::SharedMemoryReader const& reader,
+		std::unordered_map<std::string, std::uint64_t>& previousResolveCounts,
+		double const intervalSeconds)
+	{
+		std::cout << "Writer process " << reader.GetWriterProcessId()
+				  << ", published " << reader.GetPublishCount() << " times, "
+				  << reader.GetDroppedCount() << " bindings dropped\n";
+
+		std::cout << std::setw(12) << "Resolves" << std::setw(10) << "Failures" << std::setw(12) << "Rate/s"
+				  << std::setw(12) << "Mean (ns)" << std::setw(12) << "p50 (ns)" << std::setw(12) << "p99 (ns)"
+				  << "  Binding\n";
+
+		for (auto const& statistics : reader.Read())
+		{
+			auto const mean = statistics.resolveCount == 0
+				? 0
+				: statistics.inclusiveTime.count() / static_cast<std::int64_t>(statistics.resolveCount);
+
+			// The rate is only known once the binding has been sampled before.
+			auto const previous = previousResolveCounts.find(statistics.key);
+			auto const rate = previous == previousResolveCounts.end() || intervalSeconds <= 0.0
+				? 0.0
+				: static_cast<double>(statistics.resolveCount - previous->second) / intervalSeconds;
+			previousResolveCounts[statistics.key] = statistics.resolveCount;
+
+			std::cout << std::setw(12) << statistics.resolveCount
+					  << std::setw(10) << statistics.failureCount
+					  << std::setw(12) << std::fixed << std::setprecision(1) << rate
+					  << std::setw(12) << mean
+					  << std::setw(12) << statistics.latency.GetPercentile(50.0).count()
+					  << std::setw(12) << statistics.latency.GetPercentile(99.0).count()
+					  << "  " << statistics.key << " (" << statistics.bindingType << ")\n";
+		}
+
+		std::cout << std::endl;
+	}
+}
+
+int main(int argumentCount, char** arguments)
+{
+	if (argumentCount < 2)
+	{
+		std::cerr << "Usage: " << arguments[0] << " <name> [interval in seconds]\n";
+		return EXIT_FAILURE;
+	}
+
+	auto const intervalSeconds = argumentCount > 2 ? std::atof(arguments[2]) : 0.0;
+
+	try
+	{
+		auto const reader = Serum::Metrics::SharedMemoryReader(arguments[1]);
+		auto previousResolveCounts = std::unordered_map<std::string, std::uint64_t>();
+
+		do
+		{
+			Serum::Tools::MetricsReader::PrintStatistics(reader, previousResolveCounts, intervalSeconds);
+
+			if (intervalSeconds > 0.0)
+			{
+				std::this_thread::sleep_for(std::chrono::duration<double>(intervalSeconds));
+			}
+		}
+		while (intervalSeconds > 0.0);
+	}
+	catch (Serum::SerumException const& exception)
+	{
+		std::cerr << exception.what() << '\n';
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
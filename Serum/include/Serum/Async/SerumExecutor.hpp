@@ -0,0 +1,86 @@
+/// @file SerumExecutor.hpp
+/// Defines the executor abstraction used to schedule suspended resolutions.
+
+#ifndef SERUM_ASYNC_SERUM_EXECUTOR_HPP
+#define SERUM_ASYNC_SERUM_EXECUTOR_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+#ifdef SERUM_HAS_COROUTINES
+
+#include <coroutine>
+
+namespace Serum::Async
+{
+	/// A base type for executors which resume suspended resolutions.
+	class SerumExecutor
+	{
+		public:
+			/// Public virtual destructor.
+			virtual ~SerumExecutor() = default;
+
+			/// Schedules a suspended coroutine to be resumed by the executor.
+			/// @param handle The coroutine to resume.
+			virtual void Schedule(std::coroutine_handle<> handle) = 0;
+
+		protected:
+			/// Default constructor.
+			SerumExecutor() = default;
+	};
+
+	/// An executor which resumes coroutines immediately on the scheduling thread.
+	class InlineExecutor final : public SerumExecutor
+	{
+		public:
+			void Schedule(std::coroutine_handle<> handle) override
+			{
+				handle.resume();
+			}
+	};
+
+	/// An awaitable which suspends the awaiting coroutine and resumes it on an executor.
+	class ScheduleOnAwaiter final
+	{
+		public:
+			/// Initializes a new instance of the ScheduleOnAwaiter class.
+			/// @param executor The executor to resume on.
+			explicit ScheduleOnAwaiter(SerumExecutor& executor) noexcept
+				: executor(executor)
+			{
+			}
+
+			/// The awaiting coroutine is always suspended.
+			/// @returns False.
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			/// Schedules the awaiting coroutine on the executor.
+			/// @param handle The awaiting coroutine.
+			void await_suspend(std::coroutine_handle<> handle) const
+			{
+				executor.Schedule(handle);
+			}
+
+			/// Called when the coroutine is resumed on the executor.
+			void await_resume() const noexcept
+			{
+			}
+
+		private:
+			SerumExecutor& executor;
+	};
+
+	/// Suspends the awaiting coroutine and resumes it on the given executor.
+	/// @param executor The executor to resume on.
+	/// @returns An awaitable which transfers execution to the executor.
+	[[nodiscard]] inline ScheduleOnAwaiter ScheduleOn(SerumExecutor& executor) noexcept
+	{
+		return ScheduleOnAwaiter(executor);
+	}
+}
+
+#endif // SERUM_HAS_COROUTINES
+
+#endif // SERUM_ASYNC_SERUM_EXECUTOR_HPP
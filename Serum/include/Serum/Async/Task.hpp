@@ -0,0 +1,266 @@
+/// @file Task.hpp
+/// Defines a lazily started coroutine type used for asynchronous resolution.
+
+#ifndef SERUM_ASYNC_TASK_HPP
+#define SERUM_ASYNC_TASK_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+#ifdef SERUM_HAS_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <condition_variable>
+
+namespace Serum::Async
+{
+	/// A lazily started coroutine which produces a single value. The coroutine does not
+	/// start until it is awaited, at which point the awaiting coroutine is resumed once
+	/// the value has been produced.
+	/// @tparam T The type of the value produced by the task.
+	template <typename T>
+	class [[nodiscard]] Task final
+	{
+		public:
+			/// The promise type for the task coroutine.
+			class promise_type final
+			{
+				public:
+					/// Gets the task object for the coroutine.
+					/// @returns The task.
+					Task get_return_object() noexcept
+					{
+						return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+					}
+
+					/// Tasks are lazy, so always suspend initially.
+					/// @returns The initial awaiter.
+					std::suspend_always initial_suspend() const noexcept
+					{
+						return {};
+					}
+
+					/// Transfers control to the awaiting coroutine, if any.
+					/// @returns The final awaiter.
+					auto final_suspend() const noexcept
+					{
+						struct FinalAwaiter final
+						{
+							bool await_ready() const noexcept
+							{
+								return false;
+							}
+
+							std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+							{
+								auto const continuation = handle.promise().continuation;
+
+								return continuation ? continuation : std::noop_coroutine();
+							}
+
+							void await_resume() const noexcept
+							{
+							}
+						};
+
+						return FinalAwaiter{};
+					}
+
+					/// Stores the value produced by the coroutine.
+					/// @param result The value.
+					template <typename TValue>
+					void return_value(TValue&& result)
+					{
+						value.emplace(std::forward<TValue>(result));
+					}
+
+					/// Stores the exception thrown by the coroutine so it can be rethrown to the awaiter.
+					void unhandled_exception() noexcept
+					{
+						exception = std::current_exception();
+					}
+
+				private:
+					friend class Task;
+
+					std::coroutine_handle<> continuation = nullptr;
+					std::optional<T> value = std::nullopt;
+					std::exception_ptr exception = nullptr;
+			};
+
+			/// Deleted copy constructor.
+			Task(Task const&) = delete;
+
+			/// Move constructor.
+			/// @param task The task to move.
+			Task(Task&& task) noexcept
+				: handle(std::exchange(task.handle, nullptr))
+			{
+			}
+
+			/// Destroys the coroutine frame, if owned.
+			~Task()
+			{
+				if (handle)
+				{
+					handle.destroy();
+				}
+			}
+
+			/// Deleted copy assignment operator.
+			Task& operator=(Task const&) = delete;
+
+			/// Move assignment operator.
+			/// @param task The task to move.
+			Task& operator=(Task&& task) noexcept
+			{
+				if (this != &task)
+				{
+					if (handle)
+					{
+						handle.destroy();
+					}
+
+					handle = std::exchange(task.handle, nullptr);
+				}
+
+				return *this;
+			}
+
+			/// Awaiting a task is never immediately ready since the task is lazy.
+			/// @returns False.
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			/// Starts the task, resuming the awaiting coroutine once it completes.
+			/// @param awaiter The awaiting coroutine.
+			/// @returns The coroutine to transfer control to.
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+			{
+				handle.promise().continuation = awaiter;
+
+				return handle;
+			}
+
+			/// Gets the result of the task.
+			/// @returns The value produced by the task.
+			/// @throws Any exception thrown from within the task.
+			T await_resume()
+			{
+				auto& promise = handle.promise();
+
+				if (promise.exception)
+				{
+					std::rethrow_exception(promise.exception);
+				}
+
+				return std::move(*promise.value);
+			}
+
+		private:
+			std::coroutine_handle<promise_type> handle;
+
+			explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+				: handle(handle)
+			{
+			}
+	};
+}
+
+namespace Serum::Internal
+{
+	/// A fire-and-forget coroutine which destroys itself on completion.
+	struct DetachedTask final
+	{
+		struct promise_type final
+		{
+			DetachedTask get_return_object() const noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never initial_suspend() const noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never final_suspend() const noexcept
+			{
+				return {};
+			}
+
+			void return_void() const noexcept
+			{
+			}
+
+			void unhandled_exception() const noexcept
+			{
+				std::terminate();
+			}
+		};
+	};
+
+	/// Shared state between SyncWait and the coroutine driving the task.
+	template <typename T>
+	struct SyncWaitState final
+	{
+		std::mutex mutex{};
+		std::condition_variable condition{};
+		bool isComplete = false;
+		std::optional<T> value = std::nullopt;
+		std::exception_ptr exception = nullptr;
+	};
+
+	template <typename T>
+	DetachedTask RunAndSignal(Async::Task<T>& task, SyncWaitState<T>& state)
+	{
+		try
+		{
+			state.value.emplace(co_await std::move(task));
+		}
+		catch (...)
+		{
+			state.exception = std::current_exception();
+		}
+
+		// Notify while holding the lock so the waiting thread cannot destroy
+		// the state before notification has finished.
+		auto const lock = std::lock_guard(state.mutex);
+		state.isComplete = true;
+		state.condition.notify_one();
+	}
+}
+
+namespace Serum::Async
+{
+	/// Blocks the calling thread until the task has completed.
+	/// @tparam T The type of the value produced by the task.
+	/// @param task The task to wait for.
+	/// @returns The value produced by the task.
+	/// @throws Any exception thrown from within the task.
+	template <typename T>
+	T SyncWait(Task<T> task)
+	{
+		auto state = Internal::SyncWaitState<T>();
+
+		Internal::RunAndSignal(task, state);
+
+		auto lock = std::unique_lock(state.mutex);
+		state.condition.wait(lock, [&state] { return state.isComplete; });
+
+		if (state.exception)
+		{
+			std::rethrow_exception(state.exception);
+		}
+
+		return std::move(*state.value);
+	}
+}
+
+#endif // SERUM_HAS_COROUTINES
+
+#endif // SERUM_ASYNC_TASK_HPP
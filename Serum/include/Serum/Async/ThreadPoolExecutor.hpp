@@ -0,0 +1,104 @@
+/// @file ThreadPoolExecutor.hpp
+/// Defines an executor which resumes suspended resolutions on a fixed pool of threads.
+
+#ifndef SERUM_ASYNC_THREAD_POOL_EXECUTOR_HPP
+#define SERUM_ASYNC_THREAD_POOL_EXECUTOR_HPP
+
+#include "Serum/Async/SerumExecutor.hpp"
+
+#ifdef SERUM_HAS_COROUTINES
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+namespace Serum::Async
+{
+	/// Resumes suspended resolutions on a fixed pool of worker threads.
+	class ThreadPoolExecutor final : public SerumExecutor
+	{
+		public:
+			/// Initializes a new instance of the ThreadPoolExecutor class.
+			/// @param numberOfThreads The number of worker threads. Must be greater than zero.
+			/// @throws SerumException If the number of threads is zero.
+			explicit ThreadPoolExecutor(std::size_t const numberOfThreads)
+			{
+				if (numberOfThreads == 0)
+				{
+					throw SerumException("Cannot create thread pool executor - the number of threads must be greater than zero.");
+				}
+
+				workers.reserve(numberOfThreads);
+
+				for (auto i = std::size_t(0); i < numberOfThreads; ++i)
+				{
+					workers.emplace_back([this] { this->Run(); });
+				}
+			}
+
+			/// Deleted copy constructor.
+			ThreadPoolExecutor(ThreadPoolExecutor const&) = delete;
+
+			/// Deleted copy assignment operator.
+			ThreadPoolExecutor& operator=(ThreadPoolExecutor const&) = delete;
+
+			/// Drains any scheduled work and joins the worker threads.
+			~ThreadPoolExecutor() override
+			{
+				{
+					auto const lock = std::lock_guard(mutex);
+					isStopping = true;
+				}
+
+				condition.notify_all();
+
+				for (auto& worker : workers)
+				{
+					worker.join();
+				}
+			}
+
+			void Schedule(std::coroutine_handle<> handle) override
+			{
+				{
+					auto const lock = std::lock_guard(mutex);
+					queue.push_back(handle);
+				}
+
+				condition.notify_one();
+			}
+
+		private:
+			std::mutex mutex{};
+			std::condition_variable condition{};
+			std::deque<std::coroutine_handle<>> queue{};
+			std::vector<std::thread> workers{};
+			bool isStopping = false;
+
+			void Run()
+			{
+				while (true)
+				{
+					auto lock = std::unique_lock(mutex);
+					condition.wait(lock, [this] { return isStopping || !queue.empty(); });
+
+					if (queue.empty())
+					{
+						return;
+					}
+
+					auto const handle = queue.front();
+					queue.pop_front();
+					lock.unlock();
+
+					handle.resume();
+				}
+			}
+	};
+}
+
+#endif // SERUM_HAS_COROUTINES
+
+#endif // SERUM_ASYNC_THREAD_POOL_EXECUTOR_HPP
@@ -0,0 +1,55 @@
+/// @file AsyncSerumResolver.hpp
+/// Defines a base type for allowing custom asynchronous resolution logic
+/// to be bound into the container.
+
+#ifndef SERUM_ASYNC_SERUM_RESOLVER_HPP
+#define SERUM_ASYNC_SERUM_RESOLVER_HPP
+
+#include "Serum/ResolutionContext.hpp"
+#include "Serum/Async/Task.hpp"
+
+#ifdef SERUM_HAS_COROUTINES
+
+namespace Serum
+{
+	/// A resolver whose Resolve method is a coroutine. Dependencies can be awaited
+	/// using SerumContainer::GetAsync without blocking the resolving thread.
+	/// @tparam TResolve The type of the resolved object.
+	template <typename TResolve>
+	class AsyncSerumResolver
+	{
+		public:
+			/// Public virtual destructor.
+			virtual ~AsyncSerumResolver() = default;
+
+			/// Copy constructor.
+			/// @param resolver The resolver.
+			AsyncSerumResolver(AsyncSerumResolver const& resolver) noexcept = default;
+
+			/// Move constructor.
+			/// @param resolver The resolver.
+			AsyncSerumResolver(AsyncSerumResolver&& resolver) noexcept = default;
+
+			/// Copy assignment operator.
+			/// @param resolver The resolver.
+			AsyncSerumResolver& operator=(AsyncSerumResolver const& resolver) = default;
+
+			/// Move assignment operator.
+			/// @param resolver The resolver.
+			AsyncSerumResolver& operator=(AsyncSerumResolver&& resolver) = default;
+
+			/// Resolves the binding.
+			/// @param container The container resolving the binding, from which dependencies can be awaited.
+			/// @param resolutionContext The resolution context.
+			/// @returns A task which produces the resolved binding.
+			virtual Async::Task<TResolve> Resolve(SerumContainer& container, ResolutionContext& resolutionContext) = 0;
+
+		protected:
+			/// Default constructor.
+			AsyncSerumResolver() = default;
+	};
+}
+
+#endif // SERUM_HAS_COROUTINES
+
+#endif // SERUM_ASYNC_SERUM_RESOLVER_HPP
@@ -0,0 +1,83 @@
+/// @file AsyncResolverBinding.hpp
+/// Defines a type for a binding that uses an AsyncSerumResolver to resolve the binding.
+
+#ifndef SERUM_BINDINGS_ASYNC_RESOLVER_BINDING_HPP
+#define SERUM_BINDINGS_ASYNC_RESOLVER_BINDING_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/Binding.hpp"
+#include "Serum/AsyncSerumResolver.hpp"
+#include "Serum/Async/SerumExecutor.hpp"
+
+#ifdef SERUM_HAS_COROUTINES
+
+namespace Serum::Bindings
+{
+	/// A binding that uses an AsyncSerumResolver to resolve the binding.
+	/// @tparam TRequest The type of the requested object.
+	template <typename TRequest>
+	class AsyncResolverBinding final : public Binding<TRequest>
+	{
+		public:
+			/// Initializes a new instance of the AsyncResolverBinding class.
+			/// @param resolverPointer A pointer to the resolver to use.
+			/// @param container The container which the resolver awaits dependencies from.
+			/// @param executor Optionally, the executor to resume the resolver on. If this is null,
+			/// the executor given at resolution time is used.
+			/// @param name Optionally, a name for the binding.
+			explicit AsyncResolverBinding(
+				std::shared_ptr<AsyncSerumResolver<TRequest>> resolverPointer,
+				SerumContainer& container,
+				std::shared_ptr<Async::SerumExecutor> executor = nullptr,
+				std::string const& name = "") noexcept
+				: Binding<TRequest>(BindingType::AsyncResolver, name),
+				  resolver(std::move(resolverPointer)),
+				  container(&container),
+				  executor(std::move(executor))
+			{
+			}
+
+			[[nodiscard]] std::shared_ptr<Binding<TRequest>> Clone() const override
+			{
+				return std::make_shared<AsyncResolverBinding>(*this);
+			}
+
+			/// Resolves the binding asynchronously. The binding must outlive the returned task. The resolution may
+			/// complete on another thread, so it is reported to observers and metrics as described by AsyncResolutionScope.
+			/// @param context The resolution context. This must outlive the returned task.
+			/// @param fallbackExecutor The executor to use if the binding does not have its own. May be null.
+			/// @returns A task which produces the resolved service.
+			Async::Task<TRequest> ResolveAsync(ResolutionContext& context, Async::SerumExecutor* fallbackExecutor)
+			{
+				auto const scope = typename Binding<TRequest>::AsyncResolutionScope(*this, context);
+
+				auto* const resolutionExecutor = executor != nullptr ? executor.get() : fallbackExecutor;
+				co_return co_await ResolveOnExecutor(context, resolutionExecutor);
+			}
+
+		protected:
+			TRequest ResolveCore(ResolutionContext& resolutionContext) override
+			{
+				return Async::SyncWait(ResolveOnExecutor(resolutionContext, executor.get()));
+			}
+
+		private:
+			std::shared_ptr<AsyncSerumResolver<TRequest>> resolver;
+			SerumContainer* container;
+			std::shared_ptr<Async::SerumExecutor> executor;
+
+			Async::Task<TRequest> ResolveOnExecutor(ResolutionContext& context, Async::SerumExecutor* resolutionExecutor)
+			{
+				if (resolutionExecutor != nullptr)
+				{
+					co_await Async::ScheduleOn(*resolutionExecutor);
+				}
+
+				co_return co_await resolver->Resolve(*container, context);
+			}
+	};
+}
+
+#endif // SERUM_HAS_COROUTINES
+
+#endif // SERUM_BINDINGS_ASYNC_RESOLVER_BINDING_HPP
@@ -5,72 +5,54 @@
 #define SERUM_BINDINGS_BINDING_HPP
 
 #include "Serum/Internal/Common.hpp"
-#include "Serum/Bindings/BindingType.hpp"
-#include "Serum/Bindings/BindingKey.hpp"
-#include "Serum/ResolutionContext.hpp"
+#include "Serum/Bindings/BindingBase.hpp"
 
 namespace Serum::Bindings
 {
 	/// Stores information about a binding.
 	/// @tparam TRequest The type used to request the service in the binding.
 	template <typename TRequest>
-	class Binding
+	class Binding : public BindingBase
 	{
 		public:
-			/// Deleted default constructor.
-			Binding() = delete;
-
-			/// Copy constructor.
-			/// @param binding The binding to copy.
-			Binding(Binding const& binding) noexcept = default;
-
-			/// Move constructor.
-			/// @param binding The binding to move.
-			Binding(Binding&& binding) noexcept = default;
-
-			/// Public virtual destructor.
-			virtual ~Binding() = default;
-
-			/// Copy assignment operator.
-			/// @param binding The binding to copy.
-			Binding& operator=(Binding const& binding) = default;
-
-			/// Move assignment operator.
-			/// @param binding The binding to move.
-			Binding& operator=(Binding&& binding) = default;
+			/// The type used to request the service in the binding.
+			using RequestType = TRequest;
 
 			/// Resolves the binding.
 			/// @param context The resolution context.
 			/// @returns The resolved service.
+			/// @throws CircularDependencyException If the binding is already being resolved in the context.
 			TRequest Resolve(ResolutionContext& context)
 			{
-				context.resolutionPath.emplace_back(key);
-
-				auto result = ResolveCore(context);
-
-				context.resolutionPath.pop_back();
-
-				return result;
+				if constexpr (!IsResolutionScopeRequired)
+				{
+#ifdef SERUM_HAS_OBSERVERS
+					if (context.GetObserver() != nullptr)
+					{
+						auto const scope = ResolutionScope(*this, context);
+
+						return ResolveCore(context);
+					}
+#endif
+
+#ifdef SERUM_HAS_TRACEPOINTS
+					auto const tracepoint = ResolutionTracepoint(*this);
+#endif
+
+					return ResolveCore(context);
+				}
+				else
+				{
+					auto const scope = ResolutionScope(*this, context);
+
+					return ResolveCore(context);
+				}
 			}
 
 			/// Deep clones the binding.
 			/// @returns A clone of the binding.
 			virtual std::shared_ptr<Binding<TRequest>> Clone() const = 0;
 
-			/// Gets the binding type.
-			/// @returns The binding type.
-			[[nodiscard]] BindingType GetBindingType() const noexcept
-			{
-				return bindingType;
-			}
-
-			/// Gets a type index for the binding.
-			/// @returns The type index for the binding.
-			[[nodiscard]] BindingKey GetBindingKey() const noexcept
-			{
-				return key;
-			}
-
 		protected:
 			/// Initializes a new instance of the Binding class.
 			/// @param bindingType The binding type.
@@ -78,8 +60,7 @@ namespace Serum::Bindings
 			explicit Binding(
 				BindingType const bindingType,
 				std::string const& name = "") noexcept
-				: bindingType(bindingType),
-				  key(BindingKey(typeid(TRequest), name))
+				: BindingBase(bindingType, typeid(TRequest), name)
 			{
 			}
 
@@ -88,9 +69,16 @@ namespace Serum::Bindings
 			/// @returns The resolved service.
 			virtual TRequest ResolveCore(ResolutionContext& resolutionContext) = 0;
 
-		private:
-			BindingType bindingType;
-			BindingKey key;
+			/// Resolves a binding without recording the resolution, for bindings which wrap another binding and have
+			/// already recorded it. The wrapped binding's time, allocations and dependencies are then attributed to the
+			/// wrapping binding, which is the one the container reports.
+			/// @param binding The wrapped binding.
+			/// @param resolutionContext The resolution context.
+			/// @returns The resolved service.
+			static TRequest ResolveWrapped(Binding& binding, ResolutionContext& resolutionContext)
+			{
+				return binding.ResolveCore(resolutionContext);
+			}
 	};
 }
 
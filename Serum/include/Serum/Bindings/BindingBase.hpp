@@ -0,0 +1,585 @@
+/// @file BindingBase.hpp
+/// Defines the parts of a binding which do not depend on the type it resolves.
+
+#ifndef SERUM_BINDINGS_BINDING_BASE_HPP
+#define SERUM_BINDINGS_BINDING_BASE_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/BindingType.hpp"
+#include "Serum/Bindings/BindingKey.hpp"
+#include "Serum/ResolutionContext.hpp"
+#include "Serum/ResolutionTracking.hpp"
+#include "Serum/CircularDependencyException.hpp"
+#include "Serum/Internal/Tracepoints.hpp"
+
+#ifdef SERUM_ENABLE_METRICS
+#include "Serum/Metrics/BindingMetrics.hpp"
+
+#include <algorithm>
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+#include "Serum/SerumObserver.hpp"
+#endif
+
+#if defined(SERUM_ENABLE_METRICS) || defined(SERUM_HAS_OBSERVERS)
+#include <chrono>
+#include <exception>
+#endif
+
+namespace Serum::Bindings
+{
+	/// Stores the information about a binding which does not depend on the type it resolves, and records
+	/// resolutions in the resolution context. Keeping this out of Binding means it is compiled once, rather
+	/// than once for every bound type.
+	class BindingBase
+	{
+		public:
+			/// Deleted default constructor.
+			BindingBase() = delete;
+
+			/// Copy constructor.
+			/// @param binding The binding to copy.
+			BindingBase(BindingBase const& binding) noexcept = default;
+
+			/// Move constructor.
+			/// @param binding The binding to move.
+			BindingBase(BindingBase&& binding) noexcept = default;
+
+			/// Public virtual destructor.
+			virtual ~BindingBase() = default;
+
+			/// Copy assignment operator.
+			/// @param binding The binding to copy.
+			BindingBase& operator=(BindingBase const& binding) = default;
+
+			/// Move assignment operator.
+			/// @param binding The binding to move.
+			BindingBase& operator=(BindingBase&& binding) = default;
+
+			/// Gets the binding type.
+			/// @returns The binding type.
+			[[nodiscard]] BindingType GetBindingType() const noexcept
+			{
+				return bindingType;
+			}
+
+			/// Gets the identifier of the binding. Copies of a binding share its identifier.
+			/// @returns The identifier of the binding.
+			[[nodiscard]] Internal::BindingId GetBindingId() const noexcept
+			{
+				return id;
+			}
+
+			/// Gets a type index for the binding.
+			/// @returns The type index for the binding.
+			[[nodiscard]] BindingKey const& GetBindingKey() const noexcept
+			{
+				return key;
+			}
+
+#ifdef SERUM_ENABLE_METRICS
+			/// Gets the resolution metrics of the binding. Copies of a binding share its metrics.
+			/// @returns The resolution metrics.
+			[[nodiscard]] Metrics::BindingMetrics& GetMetrics() const noexcept
+			{
+				return *metrics;
+			}
+#endif
+
+		protected:
+			/// Whether resolving a binding always needs a ResolutionScope. When it does not, Resolve only creates one
+			/// if the context has an observer, and otherwise calls ResolveCore directly.
+#ifdef SERUM_ENABLE_METRICS
+			static constexpr auto IsResolutionScopeRequired = true;
+#else
+			static constexpr auto IsResolutionScopeRequired = ConfiguredResolutionTracking != ResolutionTracking::None;
+#endif
+
+			/// Initializes a new instance of the BindingBase class.
+			/// @param bindingType The binding type.
+			/// @param requestType The type used to request the service in the binding.
+			/// @param name Optionally, a name for the binding.
+			BindingBase(
+				BindingType const bindingType,
+				std::type_info const& requestType,
+				std::string const& name = "") noexcept
+				: id(Internal::NextBindingId()),
+				  bindingType(bindingType),
+				  key(BindingKey(requestType, name)),
+				  keyHash(std::hash<BindingKey>{}(key))
+#ifdef SERUM_HAS_TRACEPOINTS
+				  , tracepointTypeName(requestType.name())
+#endif
+			{
+			}
+
+#ifdef SERUM_HAS_TRACEPOINTS
+			/// Fires the serum:resolve_begin tracepoint when created and the serum:resolve_end tracepoint when destroyed,
+			/// including when the resolution throws an exception. Used instead of a ResolutionScope when none is needed.
+			class ResolutionTracepoint final
+			{
+				public:
+					/// Fires the serum:resolve_begin tracepoint.
+					/// @param binding The binding being resolved.
+					explicit ResolutionTracepoint(BindingBase const& binding) noexcept
+						: binding(binding)
+					{
+						SERUM_TRACEPOINT(resolve_begin, binding.tracepointTypeName, binding.key.GetName().c_str());
+					}
+
+					/// Deleted copy constructor.
+					ResolutionTracepoint(ResolutionTracepoint const&) = delete;
+
+					/// Fires the serum:resolve_end tracepoint.
+					~ResolutionTracepoint()
+					{
+						SERUM_TRACEPOINT(resolve_end, binding.tracepointTypeName, binding.key.GetName().c_str());
+					}
+
+					/// Deleted copy assignment operator.
+					ResolutionTracepoint& operator=(ResolutionTracepoint const&) = delete;
+
+				private:
+					BindingBase const& binding;
+			};
+#endif
+
+			/// Records that the binding is being resolved in a context for the lifetime of the scope,
+			/// notifies the context's observer, if it has one, and fires the serum:resolve_begin and
+			/// serum:resolve_end tracepoints.
+			class ResolutionScope final
+			{
+				public:
+					/// Records that the binding has started resolving in the given context.
+					/// @param binding The binding.
+					/// @param context The resolution context.
+					/// @throws CircularDependencyException If the binding is already being resolved in the context.
+					ResolutionScope(BindingBase const& binding, ResolutionContext& context)
+						: binding(binding), context(context)
+					{
+						binding.EnterResolution(context);
+
+#ifdef SERUM_HAS_TRACEPOINTS
+						SERUM_TRACEPOINT(resolve_begin, binding.tracepointTypeName, binding.key.GetName().c_str());
+#endif
+
+#if defined(SERUM_ENABLE_METRICS) || defined(SERUM_HAS_OBSERVERS)
+						uncaughtExceptions = std::uncaught_exceptions();
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+						if (observer != nullptr)
+						{
+							NotifyResolveBegin();
+						}
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+						frame = Metrics::ResolutionFrame{
+							context.metricsFrame,
+							0,
+							Metrics::AllocationCounts{ 0, 0 },
+							Metrics::AllocationCounter::GetThreadCountsAddress()
+						};
+						context.metricsFrame = &frame;
+						startAllocations = *frame.threadCounts;
+						start = Metrics::Clock::now();
+#endif
+					}
+
+					/// Deleted copy constructor.
+					ResolutionScope(ResolutionScope const&) = delete;
+
+					/// Records that the binding has finished resolving in the context.
+					~ResolutionScope()
+					{
+#ifdef SERUM_ENABLE_METRICS
+						auto const inclusiveNanoseconds = Metrics::GetNanosecondsSince(start);
+						auto const exclusiveNanoseconds = inclusiveNanoseconds > frame.childNanoseconds
+							? inclusiveNanoseconds - frame.childNanoseconds
+							: 0;
+
+						auto const allocations = *frame.threadCounts;
+						auto const inclusiveAllocations = Metrics::AllocationCounts{
+							allocations.count - startAllocations.count,
+							allocations.bytes - startAllocations.bytes
+						};
+
+						context.metricsFrame = frame.parent;
+						if (frame.parent != nullptr)
+						{
+							frame.parent->childNanoseconds += inclusiveNanoseconds;
+
+							// The parent only counts its own thread's allocations, which may not include these.
+							if (frame.parent->threadCounts == frame.threadCounts)
+							{
+								frame.parent->childAllocations.count += inclusiveAllocations.count;
+								frame.parent->childAllocations.bytes += inclusiveAllocations.bytes;
+							}
+						}
+
+						binding.GetMetrics().RecordResolution(
+							inclusiveNanoseconds,
+							exclusiveNanoseconds,
+							std::uncaught_exceptions() == uncaughtExceptions);
+						binding.GetMetrics().RecordAllocations(Metrics::AllocationCounts{
+							inclusiveAllocations.count - std::min(inclusiveAllocations.count, frame.childAllocations.count),
+							inclusiveAllocations.bytes - std::min(inclusiveAllocations.bytes, frame.childAllocations.bytes)
+						});
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+						if (observer != nullptr)
+						{
+							NotifyResolveEnd();
+						}
+#endif
+
+#ifdef SERUM_HAS_TRACEPOINTS
+						SERUM_TRACEPOINT(resolve_end, binding.tracepointTypeName, binding.key.GetName().c_str());
+#endif
+
+						binding.ExitResolution(context);
+					}
+
+					/// Deleted copy assignment operator.
+					ResolutionScope& operator=(ResolutionScope const&) = delete;
+
+				private:
+					BindingBase const& binding;
+					ResolutionContext& context;
+
+#if defined(SERUM_ENABLE_METRICS) || defined(SERUM_HAS_OBSERVERS)
+					int uncaughtExceptions = 0;
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+					Metrics::ResolutionFrame frame{};
+					Metrics::AllocationCounts startAllocations{};
+					Metrics::Clock::time_point start{};
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+					SerumObserver* const observer = context.observer;
+					std::chrono::steady_clock::time_point observedStart{};
+
+					// Notifying is kept out of line so that unobserved resolutions only pay for the null check.
+
+					SERUM_NOINLINE void NotifyResolveBegin() noexcept
+					{
+						observer->OnResolveBegin(binding.key, context.observedDepth);
+						++context.observedDepth;
+						observedStart = std::chrono::steady_clock::now();
+					}
+
+					SERUM_NOINLINE void NotifyResolveEnd() noexcept
+					{
+						auto const duration = std::chrono::steady_clock::now() - observedStart;
+
+						--context.observedDepth;
+						observer->OnResolveEnd(
+							binding.key,
+							std::chrono::duration_cast<std::chrono::nanoseconds>(duration),
+							std::uncaught_exceptions() == uncaughtExceptions);
+					}
+#endif
+			};
+
+#ifdef SERUM_HAS_COROUTINES
+			/// Records that the binding is being resolved in a context for the lifetime of the scope, where the
+			/// resolution may suspend and resume on another thread. The binding stays in the resolution path while it
+			/// is suspended, as a context is only used by one thread at a time, so cycles through awaited dependencies
+			/// are still detected. Observers, metrics and tracepoints keep per-thread state, so the resolution is only
+			/// reported to them when it completes, on the thread which completes it. It is not reported as the parent
+			/// of the dependencies it awaits, and its allocations are not counted.
+			class AsyncResolutionScope final
+			{
+				public:
+					/// Records that the binding has started resolving in the given context.
+					/// @param binding The binding.
+					/// @param context The resolution context.
+					/// @throws CircularDependencyException If the binding is already being resolved in the context.
+					AsyncResolutionScope(BindingBase const& binding, ResolutionContext& context)
+						: binding(binding), context(context)
+					{
+						binding.EnterResolution(context);
+
+#if defined(SERUM_ENABLE_METRICS) || defined(SERUM_HAS_OBSERVERS)
+						uncaughtExceptions = std::uncaught_exceptions();
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+						if (observer != nullptr)
+						{
+							observedDepth = context.observedDepth;
+							++context.observedDepth;
+							observedStart = std::chrono::steady_clock::now();
+						}
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+						// Nested resolutions add their time to the frame, but not their allocations, which may be on any thread.
+						frame = Metrics::ResolutionFrame{ context.metricsFrame, 0, Metrics::AllocationCounts{ 0, 0 }, nullptr };
+						context.metricsFrame = &frame;
+						start = Metrics::Clock::now();
+#endif
+					}
+
+					/// Deleted copy constructor.
+					AsyncResolutionScope(AsyncResolutionScope const&) = delete;
+
+					/// Records that the binding has finished resolving in the context.
+					~AsyncResolutionScope()
+					{
+#ifdef SERUM_ENABLE_METRICS
+						auto const inclusiveNanoseconds = Metrics::GetNanosecondsSince(start);
+						auto const exclusiveNanoseconds = inclusiveNanoseconds > frame.childNanoseconds
+							? inclusiveNanoseconds - frame.childNanoseconds
+							: 0;
+
+						context.metricsFrame = frame.parent;
+						if (frame.parent != nullptr)
+						{
+							frame.parent->childNanoseconds += inclusiveNanoseconds;
+						}
+
+						binding.GetMetrics().RecordResolution(
+							inclusiveNanoseconds,
+							exclusiveNanoseconds,
+							std::uncaught_exceptions() == uncaughtExceptions);
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+						if (observer != nullptr)
+						{
+							NotifyResolution();
+						}
+#endif
+
+#ifdef SERUM_HAS_TRACEPOINTS
+						SERUM_TRACEPOINT(resolve_begin, binding.tracepointTypeName, binding.key.GetName().c_str());
+						SERUM_TRACEPOINT(resolve_end, binding.tracepointTypeName, binding.key.GetName().c_str());
+#endif
+
+						binding.ExitResolution(context);
+					}
+
+					/// Deleted copy assignment operator.
+					AsyncResolutionScope& operator=(AsyncResolutionScope const&) = delete;
+
+				private:
+					BindingBase const& binding;
+					ResolutionContext& context;
+
+#if defined(SERUM_ENABLE_METRICS) || defined(SERUM_HAS_OBSERVERS)
+					int uncaughtExceptions = 0;
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+					Metrics::ResolutionFrame frame{};
+					Metrics::Clock::time_point start{};
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+					SerumObserver* const observer = context.observer;
+					std::size_t observedDepth = 0;
+					std::chrono::steady_clock::time_point observedStart{};
+
+					// Both notifications are made on the completing thread, so observers' per-thread state stays balanced.
+					SERUM_NOINLINE void NotifyResolution() noexcept
+					{
+						auto const duration = std::chrono::steady_clock::now() - observedStart;
+
+						--context.observedDepth;
+						observer->OnResolveBegin(binding.key, observedDepth);
+						observer->OnResolveEnd(
+							binding.key,
+							std::chrono::duration_cast<std::chrono::nanoseconds>(duration),
+							std::uncaught_exceptions() == uncaughtExceptions);
+					}
+#endif
+			};
+#endif
+
+			/// Measures the construction of a singleton's instance, and records it in the binding's metrics
+			/// and the context's observer, if either is enabled. Fires the serum:singleton_begin and
+			/// serum:singleton_end tracepoints around the construction.
+			class SingletonConstructionTimer final
+			{
+				public:
+					/// Starts measuring the construction of a singleton's instance.
+					/// @param binding The singleton binding.
+					/// @param context The resolution context the instance is constructed in.
+					SingletonConstructionTimer(BindingBase const& binding, ResolutionContext const& context) noexcept
+						: binding(binding)
+#ifdef SERUM_HAS_OBSERVERS
+						  , observer(context.observer)
+#endif
+					{
+						(void)context;
+
+#ifdef SERUM_HAS_TRACEPOINTS
+						SERUM_TRACEPOINT(singleton_begin, binding.tracepointTypeName, binding.key.GetName().c_str());
+#endif
+
+#if defined(SERUM_ENABLE_METRICS) || defined(SERUM_HAS_OBSERVERS)
+						if (IsMeasuring())
+						{
+							start = std::chrono::steady_clock::now();
+						}
+#endif
+					}
+
+#ifdef SERUM_HAS_TRACEPOINTS
+					/// Deleted copy constructor.
+					SingletonConstructionTimer(SingletonConstructionTimer const&) = delete;
+
+					/// Fires the serum:singleton_end tracepoint, including when the construction throws an exception.
+					~SingletonConstructionTimer()
+					{
+						SERUM_TRACEPOINT(singleton_end, binding.tracepointTypeName, binding.key.GetName().c_str());
+					}
+
+					/// Deleted copy assignment operator.
+					SingletonConstructionTimer& operator=(SingletonConstructionTimer const&) = delete;
+#endif
+
+					/// Records that the instance has been constructed.
+					void Complete() const noexcept
+					{
+#if defined(SERUM_ENABLE_METRICS) || defined(SERUM_HAS_OBSERVERS)
+						if (!IsMeasuring())
+						{
+							return;
+						}
+
+						auto const duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+							std::chrono::steady_clock::now() - start);
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+						binding.GetMetrics().RecordSingletonConstruction(static_cast<std::uint64_t>(duration.count()));
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+						if (observer != nullptr)
+						{
+							observer->OnSingletonCreated(binding.key, duration);
+						}
+#endif
+					}
+
+				private:
+					BindingBase const& binding;
+
+#ifdef SERUM_HAS_OBSERVERS
+					SerumObserver* observer;
+#endif
+
+#if defined(SERUM_ENABLE_METRICS) || defined(SERUM_HAS_OBSERVERS)
+					std::chrono::steady_clock::time_point start{};
+#endif
+
+					[[nodiscard]] bool IsMeasuring() const noexcept
+					{
+#if defined(SERUM_ENABLE_METRICS)
+						return true;
+#elif defined(SERUM_HAS_OBSERVERS)
+						return observer != nullptr;
+#else
+						return false;
+#endif
+					}
+			};
+
+			/// Records that the binding has started resolving in the given context. Prefer ResolutionScope,
+			/// which guarantees that ExitResolution is called.
+			/// @param context The resolution context.
+			/// @throws CircularDependencyException If the binding is already being resolved in the context.
+			void EnterResolution(ResolutionContext& context) const
+			{
+				// The set of active bindings makes cycle detection constant time per resolution,
+				// rather than a linear scan of the resolution path.
+
+				if constexpr (ConfiguredResolutionTracking == ResolutionTracking::Cycles)
+				{
+					if (!context.activeBindings.Insert(id))
+					{
+						ThrowCircularDependency(context);
+					}
+				}
+				else if constexpr (ConfiguredResolutionTracking == ResolutionTracking::Full)
+				{
+					if (!context.activeBindings.Insert(id))
+					{
+						ThrowCircularDependency(context);
+					}
+
+					try
+					{
+						context.resolutionPath.EmplaceBack(GetPathEntry());
+					}
+					catch (...)
+					{
+						context.activeBindings.Erase(id);
+						throw;
+					}
+				}
+			}
+
+			/// Records that the binding has finished resolving in the given context.
+			/// @param context The resolution context.
+			void ExitResolution(ResolutionContext& context) const noexcept
+			{
+				if constexpr (ConfiguredResolutionTracking == ResolutionTracking::Full)
+				{
+					context.resolutionPath.PopBack();
+				}
+
+				if constexpr (ConfiguredResolutionTracking != ResolutionTracking::None)
+				{
+					context.activeBindings.Erase(id);
+				}
+			}
+
+		private:
+			Internal::BindingId id;
+			BindingType bindingType;
+			BindingKey key;
+
+			// Hashed once, so resolution path queries compare integers rather than keys.
+			std::size_t keyHash;
+
+#ifdef SERUM_HAS_TRACEPOINTS
+			// Stored so that tracepoints pass the name without calling std::type_info::name on every resolution.
+			char const* tracepointTypeName;
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+			std::shared_ptr<Metrics::BindingMetrics> metrics = std::make_shared<Metrics::BindingMetrics>();
+#endif
+
+			/// Gets the entry which identifies the binding in a resolution path. The entry refers to this binding's key,
+			/// so it is created when needed rather than stored, and stays valid when the binding is copied.
+			/// @returns The resolution path entry.
+			[[nodiscard]] Internal::ResolutionPathEntry GetPathEntry() const noexcept
+			{
+				return Internal::ResolutionPathEntry{ id, keyHash, &key };
+			}
+
+			[[noreturn]] SERUM_NOINLINE SERUM_COLD void ThrowCircularDependency(ResolutionContext const& context) const
+			{
+				if constexpr (ConfiguredResolutionTracking == ResolutionTracking::Full)
+				{
+					throw CircularDependencyException(context.GetCycle(GetPathEntry()));
+				}
+				else
+				{
+					throw CircularDependencyException({ key });
+				}
+			}
+	};
+}
+
+#endif // SERUM_BINDINGS_BINDING_BASE_HPP
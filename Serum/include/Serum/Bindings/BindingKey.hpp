@@ -6,6 +6,9 @@
 
 #include "Serum/Internal/Common.hpp"
 
+#include <iosfwd>
+#include <typeindex>
+
 namespace Serum::Bindings
 {
 	/// A key type for bindings which allows them to be stored in maps.
@@ -32,13 +35,23 @@ namespace Serum::Bindings
 			BindingKey& operator=(BindingKey const& key) = default;
 
 			/// Overload of the stream operator.
+			/// This is a template so that only translation units which stream binding keys need to include <ostream>.
 			/// @param stream The stream.
 			/// @param bindingKey The binding key.
 			/// @returns The stream.
-			friend std::ostream& operator <<(std::ostream& stream, BindingKey const& bindingKey)
+			template <typename TChar, typename TTraits>
+			friend std::basic_ostream<TChar, TTraits>& operator <<(
+				std::basic_ostream<TChar, TTraits>& stream,
+				BindingKey const& bindingKey)
+			{
+				return stream << bindingKey.ToString();
+			}
+
+			/// Gets a string representation of the key.
+			/// @returns The request type name and the binding name, in the form [type, "name"].
+			[[nodiscard]] std::string ToString() const
 			{
-				stream << "[" << bindingKey.requestType.name() << ", \"" << bindingKey.name << "\"]";
-				return stream;
+				return std::string("[") + requestType.name() + ", \"" + name + "\"]";
 			}
 
 			/// Equality operator for binding keys.
@@ -58,7 +71,7 @@ namespace Serum::Bindings
 
 			/// Gets the name of the binding.
 			/// @returns The name of the binding.
-			[[nodiscard]] std::string GetName() const noexcept
+			[[nodiscard]] std::string const& GetName() const noexcept
 			{
 				return name;
 			}
@@ -0,0 +1,85 @@
+/// @file BindingLifetime.hpp
+/// Defines an enumeration for how long the services resolved from bindings live.
+
+#ifndef SERUM_BINDINGS_BINDING_LIFETIME_HPP
+#define SERUM_BINDINGS_BINDING_LIFETIME_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/BindingType.hpp"
+
+#include <iosfwd>
+
+namespace Serum::Bindings
+{
+	/// An enumeration for how long the services resolved from bindings live.
+	enum class BindingLifetime
+	{
+		/// A new service is resolved every time the binding is resolved.
+		Transient,
+
+		/// The service is resolved once per resolution context.
+		PerResolution,
+
+		/// The service is resolved once, and lives as long as the binding.
+		Singleton,
+
+		/// The service is owned outside of the container.
+		External
+	};
+
+	/// Gets the lifetime of the services resolved from a type of binding.
+	/// @param bindingType The binding type.
+	/// @returns The lifetime.
+	[[nodiscard]] constexpr BindingLifetime GetBindingLifetime(BindingType const bindingType) noexcept
+	{
+		switch (bindingType)
+		{
+			case BindingType::Singleton:
+			case BindingType::Constant:
+				return BindingLifetime::Singleton;
+
+			case BindingType::PerResolution:
+				return BindingLifetime::PerResolution;
+
+			case BindingType::Instance:
+				return BindingLifetime::External;
+
+			default:
+				return BindingLifetime::Transient;
+		}
+	}
+
+	/// Gets the name of a binding lifetime.
+	/// @param lifetime The binding lifetime.
+	/// @returns The name of the binding lifetime.
+	[[nodiscard]] constexpr char const* ToString(BindingLifetime const lifetime) noexcept
+	{
+		switch (lifetime)
+		{
+			case BindingLifetime::Transient:
+				return "Transient";
+
+			case BindingLifetime::PerResolution:
+				return "PerResolution";
+
+			case BindingLifetime::Singleton:
+				return "Singleton";
+
+			case BindingLifetime::External:
+				return "External";
+
+			default:
+				return "Unknown binding lifetime";
+		}
+	}
+
+	/// Overload of the stream operator for string functionality.
+	/// This is a template so that only translation units which stream binding lifetimes need to include <ostream>.
+	template <typename TChar, typename TTraits>
+	std::basic_ostream<TChar, TTraits>& operator <<(std::basic_ostream<TChar, TTraits>& stream, BindingLifetime const lifetime)
+	{
+		return stream << ToString(lifetime);
+	}
+}
+
+#endif // SERUM_BINDINGS_BINDING_LIFETIME_HPP
@@ -6,6 +6,8 @@
 
 #include "Serum/Internal/Common.hpp"
 
+#include <iosfwd>
+
 namespace Serum::Bindings
 {
 	/// An enumeration for the different types of bindings.
@@ -21,36 +23,67 @@ namespace Serum::Bindings
 		Resolver,
 
 		/// The type is bound such that it is resolved only once.
-		Singleton
+		Singleton,
+
+		/// The type is bound such that it is resolved only once per resolution context.
+		PerResolution,
+
+		/// The type is bound to a constant value owned by the binding.
+		Constant,
+
+		/// The type is bound to an externally owned instance.
+		Instance,
+
+#ifdef SERUM_HAS_COROUTINES
+		/// The type is bound to the result of a coroutine on an AsyncSerumResolver instance.
+		AsyncResolver,
+#endif
 	};
 
-	/// Overload of the stream operator for string functionality.
-	inline std::ostream& operator <<(std::ostream& stream, BindingType const binding)
+	/// Gets the name of a binding type.
+	/// @param binding The binding type.
+	/// @returns The name of the binding type.
+	[[nodiscard]] constexpr char const* ToString(BindingType const binding) noexcept
 	{
 		switch (binding)
 		{
 			case BindingType::Unknown:
-				stream << "Unknown";
-				break;
+				return "Unknown";
 
 			case BindingType::Function:
-				stream << "Function";
-				break;
+				return "Function";
 
 			case BindingType::Resolver:
-				stream << "Resolver";
-				break;
+				return "Resolver";
 
 			case BindingType::Singleton:
-				stream << "Singleton";
-				break;
+				return "Singleton";
+
+			case BindingType::PerResolution:
+				return "PerResolution";
+
+			case BindingType::Constant:
+				return "Constant";
+
+			case BindingType::Instance:
+				return "Instance";
+
+#ifdef SERUM_HAS_COROUTINES
+			case BindingType::AsyncResolver:
+				return "AsyncResolver";
+#endif
 
 			default:
-				stream << "Unknown binding type";
-				break;
+				return "Unknown binding type";
 		}
+	}
 
-		return stream;
+	/// Overload of the stream operator for string functionality.
+	/// This is a template so that only translation units which stream binding types need to include <ostream>.
+	template <typename TChar, typename TTraits>
+	std::basic_ostream<TChar, TTraits>& operator <<(std::basic_ostream<TChar, TTraits>& stream, BindingType const binding)
+	{
+		return stream << ToString(binding);
 	}
 }
 
@@ -0,0 +1,45 @@
+/// @file ConstantBinding.hpp
+/// Defines a type for a binding to a constant value owned by the binding.
+
+#ifndef SERUM_BINDINGS_CONSTANT_BINDING_HPP
+#define SERUM_BINDINGS_CONSTANT_BINDING_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/ReferenceBinding.hpp"
+
+namespace Serum::Bindings
+{
+	/// A binding to a constant value. The value is stored once in the binding and can be resolved
+	/// by reference, or copied when resolved by value.
+	/// @tparam TRequest The type of the requested object.
+	template <typename TRequest>
+	class ConstantBinding final : public ReferenceBinding<TRequest>
+	{
+		public:
+			/// Initializes a new instance of the ConstantBinding class.
+			/// @param value The value. This is moved into the binding.
+			/// @param name Optionally, a name for the binding.
+			explicit ConstantBinding(TRequest value, std::string const& name = "")
+				noexcept(std::is_nothrow_move_constructible<TRequest>::value)
+				: ReferenceBinding<TRequest>(BindingType::Constant, name),
+				  value(std::make_shared<TRequest const>(std::move(value)))
+			{
+			}
+
+			[[nodiscard]] std::shared_ptr<Binding<TRequest>> Clone() const override
+			{
+				return std::make_shared<ConstantBinding>(*this);
+			}
+
+			[[nodiscard]] TRequest const& GetReference() const noexcept override
+			{
+				return *value;
+			}
+
+		private:
+			// The value is immutable, so clones of the binding can share it rather than copying it.
+			std::shared_ptr<TRequest const> value;
+	};
+}
+
+#endif // SERUM_BINDINGS_CONSTANT_BINDING_HPP
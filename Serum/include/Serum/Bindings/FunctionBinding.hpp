@@ -7,6 +7,8 @@
 #include "Serum/Internal/Common.hpp"
 #include "Serum/Bindings/Binding.hpp"
 
+#include <functional>
+
 namespace Serum::Bindings
 {
     /// Type alias for a function that resolves a TRequest instance.
@@ -15,18 +17,24 @@ namespace Serum::Bindings
     using ResolutionFunction = std::function<TRequest(ResolutionContext&)>;
 
     /// Resolves a binding as the result of a function.
+    /// The function is stored as its concrete type, so invoking it is a direct call that can be inlined
+    /// into ResolveCore, and a capturing lambda is stored inline in the binding rather than behind a std::function.
     /// @tparam TRequest The type of the requested object.
-    template <typename TRequest>
+    /// @tparam TFunction The type of the function. This must be invocable with a ResolutionContext&.
+    template <typename TRequest, typename TFunction = ResolutionFunction<TRequest>>
     class FunctionBinding final : public Binding<TRequest>
     {
+        static_assert(
+            std::is_invocable_r<TRequest, TFunction&, ResolutionContext&>::value,
+            "Cannot bind function - the function must be invocable with a ResolutionContext& and return the request type.");
 
         public:
             /// Initializes a new instance of the FunctionBinding class.
             /// @param resolveFunction The resolve function. This function is moved.
             /// @param name Optionally, the name.
             explicit FunctionBinding(
-                ResolutionFunction<TRequest> const& resolveFunction,
-                std::string const& name = "") noexcept
+                TFunction resolveFunction,
+                std::string const& name = "") noexcept(std::is_nothrow_move_constructible<TFunction>::value)
                 : Binding<TRequest>(BindingType::Function, name),
                   resolveFunction(std::move(resolveFunction))
             {
@@ -44,8 +52,22 @@ namespace Serum::Bindings
             }
 
         private:
-            ResolutionFunction<TRequest> resolveFunction;
+            TFunction resolveFunction;
     };
+
+    /// Creates a function binding which stores the concrete type of the function.
+    /// @tparam TRequest The type of the requested object.
+    /// @tparam TFunction The type of the function.
+    /// @param resolveFunction The resolve function. This function is moved.
+    /// @param name Optionally, the name.
+    /// @returns The function binding.
+    template <typename TRequest, typename TFunction>
+    [[nodiscard]] FunctionBinding<TRequest, TFunction> MakeFunctionBinding(
+        TFunction resolveFunction,
+        std::string const& name = "")
+    {
+        return FunctionBinding<TRequest, TFunction>(std::move(resolveFunction), name);
+    }
 }
 
 #endif // SERUM_BINDINGS_FUNCTION_BINDING_HPP
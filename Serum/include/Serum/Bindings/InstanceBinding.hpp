@@ -0,0 +1,44 @@
+/// @file InstanceBinding.hpp
+/// Defines a type for a binding to an externally owned instance.
+
+#ifndef SERUM_BINDINGS_INSTANCE_BINDING_HPP
+#define SERUM_BINDINGS_INSTANCE_BINDING_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/ReferenceBinding.hpp"
+
+namespace Serum::Bindings
+{
+	/// A binding to an instance owned outside of the container. The binding only stores a reference
+	/// to the instance, which must outlive the binding. The instance is only ever accessed through a const
+	/// reference, so both const and non-const instances can be bound.
+	/// @tparam TRequest The type of the requested object.
+	template <typename TRequest>
+	class InstanceBinding final : public ReferenceBinding<TRequest>
+	{
+		public:
+			/// Initializes a new instance of the InstanceBinding class.
+			/// @param instance The instance. This must outlive the binding.
+			/// @param name Optionally, a name for the binding.
+			explicit InstanceBinding(TRequest const& instance, std::string const& name = "") noexcept
+				: ReferenceBinding<TRequest>(BindingType::Instance, name),
+				  instance(&instance)
+			{
+			}
+
+			[[nodiscard]] std::shared_ptr<Binding<TRequest>> Clone() const override
+			{
+				return std::make_shared<InstanceBinding>(*this);
+			}
+
+			[[nodiscard]] TRequest const& GetReference() const noexcept override
+			{
+				return *instance;
+			}
+
+		private:
+			TRequest const* instance;
+	};
+}
+
+#endif // SERUM_BINDINGS_INSTANCE_BINDING_HPP
@@ -0,0 +1,59 @@
+/// @file PerResolutionBinding.hpp
+/// Defines a binding that wraps another binding such that it is only
+/// resolved once per resolution context.
+
+#ifndef SERUM_BINDINGS_PER_RESOLUTION_BINDING_HPP
+#define SERUM_BINDINGS_PER_RESOLUTION_BINDING_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/Binding.hpp"
+
+namespace Serum::Bindings
+{
+	/// Wraps another binding such that it is only resolved once per resolution context. Every request
+	/// for the binding made while resolving a single top-level Get returns the same instance, so shared
+	/// dependencies in a resolution graph are only constructed once.
+	/// @tparam TRequest The type of the service to request. This must be copy constructible.
+	template <typename TRequest>
+	class PerResolutionBinding final : public Binding<TRequest>
+	{
+		static_assert(
+			std::is_copy_constructible<TRequest>::value,
+			"Cannot create per-resolution binding - the request type must be copy constructible.");
+
+		public:
+			/// Initializes a new instance of the PerResolutionBinding class.
+			/// @param binding The binding to wrap.
+			explicit PerResolutionBinding(Binding<TRequest> const& binding) noexcept
+				: Binding<TRequest>(BindingType::PerResolution, binding.GetBindingKey().GetName()),
+				  innerBinding(binding.Clone())
+			{
+			}
+
+			[[nodiscard]] std::shared_ptr<Binding<TRequest>> Clone() const override
+			{
+				return std::make_shared<PerResolutionBinding>(*this);
+			}
+
+		protected:
+			TRequest ResolveCore(ResolutionContext& resolutionContext) override
+			{
+				auto const id = this->GetBindingId();
+
+				if (auto const* memoizedValue = resolutionContext.FindMemoizedInstance<TRequest>(id))
+				{
+					return *memoizedValue;
+				}
+
+				auto result = Binding<TRequest>::ResolveWrapped(*innerBinding, resolutionContext);
+				resolutionContext.MemoizeInstance(id, result);
+
+				return result;
+			}
+
+		private:
+			std::shared_ptr<Binding<TRequest>> innerBinding = nullptr;
+	};
+}
+
+#endif // SERUM_BINDINGS_PER_RESOLUTION_BINDING_HPP
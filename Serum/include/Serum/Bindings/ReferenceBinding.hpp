@@ -0,0 +1,47 @@
+/// @file ReferenceBinding.hpp
+/// Defines a base type for bindings whose resolved object lives for as long as the binding, so can be
+/// resolved by reference.
+
+#ifndef SERUM_BINDINGS_REFERENCE_BINDING_HPP
+#define SERUM_BINDINGS_REFERENCE_BINDING_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/Binding.hpp"
+
+namespace Serum::Bindings
+{
+	/// A binding whose resolved object lives at least as long as the binding, so can be resolved by reference
+	/// without copying it. Resolving the binding by value returns a copy.
+	/// @tparam TRequest The type of the requested object.
+	template <typename TRequest>
+	class ReferenceBinding : public Binding<TRequest>
+	{
+		public:
+			/// Gets a reference to the bound object. This does not copy the object or record the resolution.
+			/// @returns A reference to the bound object.
+			[[nodiscard]] virtual TRequest const& GetReference() const noexcept = 0;
+
+		protected:
+			/// Initializes a new instance of the ReferenceBinding class.
+			/// @param bindingType The binding type.
+			/// @param name Optionally, a name for the binding.
+			explicit ReferenceBinding(BindingType const bindingType, std::string const& name = "") noexcept
+				: Binding<TRequest>(bindingType, name)
+			{
+			}
+
+			TRequest ResolveCore(ResolutionContext&) override
+			{
+				if constexpr (std::is_copy_constructible<TRequest>::value)
+				{
+					return GetReference();
+				}
+				else
+				{
+					throw SerumException("Could not resolve binding - the type is not copy constructible. Resolve it with GetRef.");
+				}
+			}
+	};
+}
+
+#endif // SERUM_BINDINGS_REFERENCE_BINDING_HPP
@@ -6,6 +6,7 @@
 
 #include "Serum/Internal/Common.hpp"
 #include "Serum/Bindings/Binding.hpp"
+#include "Serum/SerumResolver.hpp"
 
 namespace Serum::Bindings
 {
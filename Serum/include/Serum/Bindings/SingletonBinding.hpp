@@ -36,13 +36,21 @@ namespace Serum::Bindings
 			{
 				if (isResolved)
 				{
+#ifdef SERUM_ENABLE_METRICS
+					this->GetMetrics().RecordSingletonHit();
+#endif
+
 					return resolvedValue;
 				}
 
-				auto result = innerBinding->Resolve(resolutionContext);
+				auto const timer = typename Binding<TRequest>::SingletonConstructionTimer(*this, resolutionContext);
+
+				auto result = Binding<TRequest>::ResolveWrapped(*innerBinding, resolutionContext);
 				resolvedValue = result;
 				isResolved = true;
 
+				timer.Complete();
+
 				return resolvedValue;
 			}
 
@@ -0,0 +1,61 @@
+/// @file CircularDependencyException.hpp
+/// Defines an exception type thrown when a circular dependency is detected during resolution.
+
+#ifndef SERUM_CIRCULAR_DEPENDENCY_EXCEPTION_HPP
+#define SERUM_CIRCULAR_DEPENDENCY_EXCEPTION_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/BindingKey.hpp"
+
+#include <vector>
+
+namespace Serum
+{
+	/// An exception thrown when a binding is requested while it is already being resolved.
+	class CircularDependencyException final : public SerumException
+	{
+		public:
+			/// Initializes a new instance of the CircularDependencyException class.
+			/// @param cycle The keys of the bindings in the cycle. The first and last keys are the same binding.
+			/// If only the repeated binding is known, this contains a single key.
+			explicit CircularDependencyException(std::vector<Bindings::BindingKey> cycle)
+				: SerumException(FormatMessage(cycle)),
+				  cycle(std::move(cycle))
+			{
+			}
+
+			/// Gets the keys of the bindings in the cycle, in resolution order. The first and last keys are
+			/// the same binding. When Serum is compiled with only cycle tracking, the resolution path is not
+			/// recorded and this only contains the key of the repeated binding.
+			/// @returns The keys of the bindings in the cycle.
+			[[nodiscard]] std::vector<Bindings::BindingKey> const& GetCycle() const noexcept
+			{
+				return cycle;
+			}
+
+		private:
+			std::vector<Bindings::BindingKey> cycle;
+
+			[[nodiscard]] static std::string FormatMessage(std::vector<Bindings::BindingKey> const& cycle)
+			{
+				if (cycle.size() == 1)
+				{
+					return "Circular dependency detected while resolving " + cycle.front().ToString()
+						+ ". Enable full resolution tracking to report the full cycle.";
+				}
+
+				auto errorMessage = std::string("Circular dependency detected: ");
+
+				for (auto i = std::size_t(0); i < cycle.size(); ++i)
+				{
+					errorMessage += (i == 0 ? "" : " -> ") + cycle[i].ToString();
+				}
+
+				errorMessage += ".";
+
+				return errorMessage;
+			}
+	};
+}
+
+#endif // SERUM_CIRCULAR_DEPENDENCY_EXCEPTION_HPP
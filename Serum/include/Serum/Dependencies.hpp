@@ -0,0 +1,25 @@
+/// @file Dependencies.hpp
+/// Defines a type list for declaring the dependencies of a type.
+
+#ifndef SERUM_DEPENDENCIES_HPP
+#define SERUM_DEPENDENCIES_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+namespace Serum
+{
+	/// A list of the request types a type depends on. Types declare their dependencies with a public
+	/// SerumDependencies alias, for example:
+	/// @code
+	/// using SerumDependencies = Serum::Dependencies<Config, std::shared_ptr<Logger>>;
+	/// @endcode
+	/// @tparam TDependencies The request types of the dependencies.
+	template <typename... TDependencies>
+	struct Dependencies final
+	{
+		/// The number of dependencies.
+		static constexpr std::size_t Count = sizeof...(TDependencies);
+	};
+}
+
+#endif // SERUM_DEPENDENCIES_HPP
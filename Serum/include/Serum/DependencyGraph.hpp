@@ -0,0 +1,218 @@
+/// @file DependencyGraph.hpp
+/// Defines a graph of the bindings in a container and the dependencies observed between them.
+
+#ifndef SERUM_DEPENDENCY_GRAPH_HPP
+#define SERUM_DEPENDENCY_GRAPH_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/Json.hpp"
+#include "Serum/Bindings/BindingKey.hpp"
+#include "Serum/Bindings/BindingType.hpp"
+#include "Serum/Bindings/BindingLifetime.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace Serum
+{
+	/// The formats a dependency graph can be exported in.
+	enum class GraphFormat
+	{
+		/// The Graphviz DOT language.
+		Dot,
+
+		/// A JSON document with a "nodes" array and an "edges" array.
+		Json
+	};
+
+	/// A binding in a dependency graph.
+	struct DependencyGraphNode final
+	{
+		/// The key of the binding.
+		Bindings::BindingKey key;
+
+		/// The type of the binding.
+		Bindings::BindingType bindingType;
+
+		/// The lifetime of the services resolved from the binding.
+		Bindings::BindingLifetime lifetime;
+	};
+
+	/// A dependency observed between two bindings in a dependency graph.
+	struct DependencyGraphEdge final
+	{
+		/// The key of the binding which resolved the dependency.
+		Bindings::BindingKey dependent;
+
+		/// The key of the dependency.
+		Bindings::BindingKey dependency;
+
+		/// The number of times the dependency was resolved by the dependent.
+		std::uint64_t resolveCount;
+
+		/// The cumulative time taken to resolve the dependency, including its own dependencies.
+		std::chrono::nanoseconds totalTime;
+	};
+
+	/// A graph of the bindings in a container and the dependencies observed between them. Nodes and edges are
+	/// ordered by their keys, so that exports of the same graph can be compared.
+	class DependencyGraph final
+	{
+		public:
+			/// Initializes a new instance of the DependencyGraph class.
+			/// @param nodes The bindings.
+			/// @param edges The dependencies between the bindings. Edges may refer to bindings which are not nodes,
+			/// such as bindings resolved from another container.
+			DependencyGraph(std::vector<DependencyGraphNode> nodes, std::vector<DependencyGraphEdge> edges)
+				: nodes(std::move(nodes)),
+				  edges(std::move(edges))
+			{
+				std::sort(this->nodes.begin(), this->nodes.end(), [](auto const& left, auto const& right)
+				{
+					return left.key.ToString() < right.key.ToString();
+				});
+
+				std::sort(this->edges.begin(), this->edges.end(), [](auto const& left, auto const& right)
+				{
+					auto const leftDependent = left.dependent.ToString();
+					auto const rightDependent = right.dependent.ToString();
+
+					return leftDependent != rightDependent
+						? leftDependent < rightDependent
+						: left.dependency.ToString() < right.dependency.ToString();
+				});
+			}
+
+			/// Gets the bindings in the graph.
+			/// @returns The nodes, ordered by key.
+			[[nodiscard]] std::vector<DependencyGraphNode> const& GetNodes() const noexcept
+			{
+				return nodes;
+			}
+
+			/// Gets the dependencies in the graph.
+			/// @returns The edges, ordered by the key of the dependent and then of the dependency.
+			[[nodiscard]] std::vector<DependencyGraphEdge> const& GetEdges() const noexcept
+			{
+				return edges;
+			}
+
+			/// Exports the graph.
+			/// @param format The format to export the graph in.
+			/// @returns The exported graph.
+			[[nodiscard]] std::string ToString(GraphFormat const format) const
+			{
+				return format == GraphFormat::Json ? ToJson() : ToDot();
+			}
+
+		private:
+			std::vector<DependencyGraphNode> nodes;
+			std::vector<DependencyGraphEdge> edges;
+
+			[[nodiscard]] std::string ToDot() const
+			{
+				auto dot = std::string("digraph Serum {\n\tnode [shape=box, style=filled];\n");
+
+				for (auto const& node : nodes)
+				{
+					dot += "\t" + ToDotString(node.key.ToString())
+						+ " [label=" + ToDotString(node.key.ToString() + "\n" + Bindings::ToString(node.bindingType) + ", " + Bindings::ToString(node.lifetime))
+						+ ", fillcolor=" + GetDotColour(node.lifetime) + "];\n";
+				}
+
+				for (auto const& edge : edges)
+				{
+					dot += "\t" + ToDotString(edge.dependent.ToString()) + " -> " + ToDotString(edge.dependency.ToString())
+						+ " [label=\"" + std::to_string(edge.resolveCount) + " x " + ToMicroseconds(edge.totalTime) + "us\""
+						+ ", weight=" + std::to_string(edge.resolveCount) + "];\n";
+				}
+
+				return dot + "}\n";
+			}
+
+			[[nodiscard]] std::string ToJson() const
+			{
+				auto json = std::string("{\"nodes\":[");
+
+				for (auto nodeIndex = std::size_t(0); nodeIndex < nodes.size(); ++nodeIndex)
+				{
+					auto const& node = nodes[nodeIndex];
+
+					json += std::string(nodeIndex == 0 ? "\n" : ",\n")
+						+ "{\"key\":" + Internal::ToJsonString(node.key.ToString())
+						+ ",\"requestType\":" + Internal::ToJsonString(node.key.GetRequestType().name())
+						+ ",\"name\":" + Internal::ToJsonString(node.key.GetName())
+						+ ",\"bindingType\":\"" + Bindings::ToString(node.bindingType)
+						+ "\",\"lifetime\":\"" + Bindings::ToString(node.lifetime) + "\"}";
+				}
+
+				json += "\n],\"edges\":[";
+
+				for (auto edgeIndex = std::size_t(0); edgeIndex < edges.size(); ++edgeIndex)
+				{
+					auto const& edge = edges[edgeIndex];
+
+					json += std::string(edgeIndex == 0 ? "\n" : ",\n")
+						+ "{\"dependent\":" + Internal::ToJsonString(edge.dependent.ToString())
+						+ ",\"dependency\":" + Internal::ToJsonString(edge.dependency.ToString())
+						+ ",\"resolveCount\":" + std::to_string(edge.resolveCount)
+						+ ",\"totalNanoseconds\":" + std::to_string(edge.totalTime.count()) + "}";
+				}
+
+				return json + "\n]}\n";
+			}
+
+			[[nodiscard]] static std::string ToDotString(std::string const& value)
+			{
+				auto dot = std::string("\"");
+
+				for (auto const character : value)
+				{
+					if (character == '"' || character == '\\')
+					{
+						dot += '\\';
+						dot += character;
+					}
+					else if (character == '\n')
+					{
+						dot += "\\n";
+					}
+					else
+					{
+						dot += character;
+					}
+				}
+
+				return dot + "\"";
+			}
+
+			[[nodiscard]] static char const* GetDotColour(Bindings::BindingLifetime const lifetime) noexcept
+			{
+				switch (lifetime)
+				{
+					case Bindings::BindingLifetime::PerResolution:
+						return "lightblue";
+
+					case Bindings::BindingLifetime::Singleton:
+						return "palegreen";
+
+					case Bindings::BindingLifetime::External:
+						return "lightgrey";
+
+					default:
+						return "white";
+				}
+			}
+
+			[[nodiscard]] static std::string ToMicroseconds(std::chrono::nanoseconds const time)
+			{
+				auto const nanoseconds = time.count() < 0 ? 0 : time.count();
+				auto const fraction = std::to_string(1000 + nanoseconds % 1000);
+
+				return std::to_string(nanoseconds / 1000) + "." + fraction.substr(1);
+			}
+	};
+}
+
+#endif // SERUM_DEPENDENCY_GRAPH_HPP
@@ -10,46 +10,69 @@
 #include "Serum/Bindings/FunctionBinding.hpp"
 #include "Serum/Bindings/ResolverBinding.hpp"
 #include "Serum/Bindings/SingletonBinding.hpp"
+#include "Serum/Bindings/PerResolutionBinding.hpp"
+#include "Serum/Bindings/ConstantBinding.hpp"
+#include "Serum/Bindings/InstanceBinding.hpp"
+#include "Serum/Bindings/AsyncResolverBinding.hpp"
 
 namespace Serum::Internal
 {
 	/// Wraps bindings such that they can be resolved dynamically at runtime.
+	/// The binding is stored once and resolved in place through its virtual ResolveCore method, so resolving
+	/// does not copy the binding or anything it captures. Copying the wrapper deep clones the binding.
 	class AnyBindingWrapper final
 	{
 		public:
 			/// Initializes a new instance of the AnyBindingWrapper type.
-			AnyBindingWrapper() noexcept
-				: bindingType(Bindings::BindingType::Unknown), binding(std::any())
-			{
-			}
+			AnyBindingWrapper() noexcept = default;
 
 			/// Initializes a new instance of the AnyBindingWrapper type.
-			/// @param functionBinding The function binding.
-			template <typename TRequest>
-			explicit AnyBindingWrapper(Bindings::FunctionBinding<TRequest> const& functionBinding) noexcept
-				: bindingType(Bindings::BindingType::Function),
-				  binding(std::any(functionBinding))
+			/// @tparam TBinding The type of the binding. This must derive from Binding.
+			/// @param binding The binding. This is moved into the wrapper.
+			template <
+				typename TBinding,
+				typename = std::enable_if_t<!std::is_same<std::decay_t<TBinding>, AnyBindingWrapper>::value>>
+			explicit AnyBindingWrapper(TBinding binding)
+				: bindingType(binding.GetBindingType()),
+				  requestType(&typeid(typename TBinding::RequestType)),
+				  binding(std::make_shared<TBinding>(std::move(binding))),
+				  clone(&CloneBinding<typename TBinding::RequestType>)
 			{
 			}
 
-			/// Initializes a new instance of the AnyBindingWrapper type.
-			/// @param resolverBinding The resolver binding.
-			template <typename TRequest>
-			explicit AnyBindingWrapper(Bindings::ResolverBinding<TRequest> const& resolverBinding) noexcept
-				: bindingType(Bindings::BindingType::Resolver),
-				  binding(std::any(resolverBinding))
+			/// Copy constructor. The wrapped binding is deep cloned.
+			/// @param other The wrapper to copy.
+			AnyBindingWrapper(AnyBindingWrapper const& other)
+				: bindingType(other.bindingType),
+				  requestType(other.requestType),
+				  binding(other.clone != nullptr ? other.clone(*other.binding) : nullptr),
+				  clone(other.clone)
 			{
 			}
 
-			/// Initializes a new instance of the AnyBindingWrapper type.
-			/// @param singletonBinding The resolver binding.
-			template <typename TRequest>
-			explicit AnyBindingWrapper(Bindings::SingletonBinding<TRequest> const& singletonBinding) noexcept
-				: bindingType(singletonBinding.GetBindingType()),
-				  binding(std::any(singletonBinding))
+			/// Move constructor.
+			/// @param other The wrapper to move.
+			AnyBindingWrapper(AnyBindingWrapper&& other) noexcept = default;
+
+			/// Destructor.
+			~AnyBindingWrapper() = default;
+
+			/// Copy assignment operator. The wrapped binding is deep cloned.
+			/// @param other The wrapper to copy.
+			AnyBindingWrapper& operator=(AnyBindingWrapper const& other)
 			{
+				if (this != &other)
+				{
+					*this = AnyBindingWrapper(other);
+				}
+
+				return *this;
 			}
 
+			/// Move assignment operator.
+			/// @param other The wrapper to move.
+			AnyBindingWrapper& operator=(AnyBindingWrapper&& other) noexcept = default;
+
 			/// Gets the underlying binding type.
 			/// @returns The underlying binding type.
 			[[nodiscard]] Bindings::BindingType GetBindingType() const noexcept
@@ -57,74 +80,118 @@ namespace Serum::Internal
 				return bindingType;
 			}
 
-			/// Gets the wrapped binding as a function binding.
+			/// Gets the wrapped binding.
 			/// @tparam TRequest The type of the request.
-			/// @returns The wrapped binding as a function binding.
-			/// @throws SerumException If the underlying type is not a function binding.
+			/// @returns The wrapped binding.
+			/// @throws SerumException If there is no wrapped binding, or it does not resolve TRequest.
 			template <typename TRequest>
-			[[nodiscard]] Bindings::FunctionBinding<TRequest> AsFunctionBinding() const
+			[[nodiscard]] Bindings::Binding<TRequest>& AsBinding() const
+			{
+				return static_cast<Bindings::Binding<TRequest>&>(GetBinding(typeid(TRequest)));
+			}
+
+			/// Gets the wrapped binding, checking that it resolves the given request type.
+			/// @param expectedRequestType The type of the request.
+			/// @returns The wrapped binding, which is a Binding of the request type.
+			/// @throws SerumException If there is no wrapped binding, or it does not resolve the request type.
+			[[nodiscard]] Bindings::BindingBase& GetBinding(std::type_info const& expectedRequestType) const
+			{
+				if (binding == nullptr)
+				{
+					ThrowUnknownBinding();
+				}
+
+				if (*requestType != expectedRequestType)
+				{
+					ThrowFailedCast();
+				}
+
+				return *binding;
+			}
+
+			/// Gets the wrapped binding, without checking the type it resolves.
+			/// @returns The wrapped binding.
+			/// @throws SerumException If there is no wrapped binding.
+			[[nodiscard]] Bindings::BindingBase& GetBinding() const
 			{
-				VerifyBindingType(Bindings::BindingType::Function);
-				return this->CastBinding<Bindings::FunctionBinding<TRequest>>();
+				if (binding == nullptr)
+				{
+					ThrowUnknownBinding();
+				}
+
+				return *binding;
 			}
 
-			/// Gets the wrapped binding as a resolver binding.
+			/// Gets the wrapped binding as a binding which can be resolved by reference.
 			/// @tparam TRequest The type of the request.
-			/// @returns The wrapped binding as a resolver binding.
-			/// @throws SerumException If the underlying type is not a resolver binding.
+			/// @returns The wrapped binding as a reference binding.
+			/// @throws SerumException If the underlying type is not a constant or instance binding.
 			template <typename TRequest>
-			[[nodiscard]] Bindings::ResolverBinding<TRequest> AsResolverBinding() const
+			[[nodiscard]] Bindings::ReferenceBinding<TRequest> const& AsReferenceBinding() const
 			{
-				VerifyBindingType(Bindings::BindingType::Resolver);
-				return this->CastBinding<Bindings::ResolverBinding<TRequest>>();
+				if (bindingType != Bindings::BindingType::Constant && bindingType != Bindings::BindingType::Instance)
+				{
+					ThrowUnexpectedBindingType("Constant or Instance");
+				}
+
+				return static_cast<Bindings::ReferenceBinding<TRequest> const&>(AsBinding<TRequest>());
 			}
 
-			/// Gets the wrapped binding as a singleton binding.
+#ifdef SERUM_HAS_COROUTINES
+			/// Gets the wrapped binding as an asynchronous resolver binding.
 			/// @tparam TRequest The type of the request.
-			/// @returns The wrapped binding as a singleton binding.
-			/// @throws SerumException If the underlying type is not a singleton binding.
+			/// @returns The wrapped binding as an asynchronous resolver binding.
+			/// @throws SerumException If the underlying type is not an asynchronous resolver binding.
 			template <typename TRequest>
-			[[nodiscard]] Bindings::SingletonBinding<TRequest> AsSingletonBinding() const
+			[[nodiscard]] Bindings::AsyncResolverBinding<TRequest>& AsAsyncResolverBinding() const
 			{
-				VerifyBindingType(Bindings::BindingType::Singleton);
-				return this->CastBinding<Bindings::SingletonBinding<TRequest>>();
+				VerifyBindingType(Bindings::BindingType::AsyncResolver);
+				return static_cast<Bindings::AsyncResolverBinding<TRequest>&>(AsBinding<TRequest>());
 			}
+#endif
 
 		private:
-			Bindings::BindingType bindingType;
-			std::any binding;
+			using CloneFunction = std::shared_ptr<Bindings::BindingBase> (*)(Bindings::BindingBase const&);
 
-			AnyBindingWrapper(const Bindings::BindingType bindingType, std::any binding) noexcept
-				: bindingType(bindingType), binding(std::move(binding))
+			Bindings::BindingType bindingType = Bindings::BindingType::Unknown;
+			std::type_info const* requestType = nullptr;
+			std::shared_ptr<Bindings::BindingBase> binding = nullptr;
+			CloneFunction clone = nullptr;
+
+			template <typename TRequest>
+			[[nodiscard]] static std::shared_ptr<Bindings::BindingBase> CloneBinding(Bindings::BindingBase const& binding)
 			{
+				return static_cast<Bindings::Binding<TRequest> const&>(binding).Clone();
 			}
 
 			void VerifyBindingType(const Bindings::BindingType expected) const
 			{
 				if (bindingType != expected)
 				{
-					std::stringstream errorMessageStream;
-					errorMessageStream << "Could not convert binding. Expected binding type was "
-									   << expected
-									   << " but actual binding type was "
-									   << bindingType
-									   << ".";
-
-					throw SerumException(errorMessageStream.str());
+					ThrowUnexpectedBindingType(Bindings::ToString(expected));
 				}
 			}
 
-			template <typename TBinding>
-			[[nodiscard]] TBinding CastBinding() const
+			// The error paths are kept out of line so that they are not duplicated into every instantiation
+			// which resolves a binding, and are placed away from the hot resolution code.
+
+			[[noreturn]] SERUM_NOINLINE SERUM_COLD static void ThrowUnknownBinding()
 			{
-				try
-				{
-					return std::any_cast<TBinding>(binding);
-				}
-				catch (std::bad_any_cast const&)
-				{
-					throw SerumException("Failed to cast underlying binding.");
-				}
+				throw SerumException("Could not resolve binding. Binding type was unknown or invalid.");
+			}
+
+			[[noreturn]] SERUM_NOINLINE SERUM_COLD static void ThrowFailedCast()
+			{
+				throw SerumException("Failed to cast underlying binding.");
+			}
+
+			[[noreturn]] SERUM_NOINLINE SERUM_COLD void ThrowUnexpectedBindingType(char const* expected) const
+			{
+				throw SerumException(std::string("Could not convert binding. Expected binding type was ")
+					+ expected
+					+ " but actual binding type was "
+					+ Bindings::ToString(bindingType)
+					+ ".");
 			}
 	};
 }
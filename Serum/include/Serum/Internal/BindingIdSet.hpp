@@ -0,0 +1,168 @@
+/// @file BindingIdSet.hpp
+/// Defines binding identifiers and an open-addressing set of them used to detect dependency cycles.
+
+#ifndef SERUM_INTERNAL_BINDING_ID_SET_HPP
+#define SERUM_INTERNAL_BINDING_ID_SET_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/SmallVector.hpp"
+
+#include <atomic>
+#include <optional>
+
+namespace Serum::Internal
+{
+	/// Uniquely identifies a binding. Copies of a binding share its identifier.
+	using BindingId = std::uint64_t;
+
+	/// Gets a new, process-wide unique binding identifier. Identifiers are never 0.
+	/// @returns The binding identifier.
+	[[nodiscard]] inline BindingId NextBindingId() noexcept
+	{
+		static std::atomic<BindingId> nextId{ 1 };
+
+		return nextId.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// An open-addressing hash set of binding identifiers with constant time insertion, lookup and removal.
+	/// Small sets are stored inline and only spill to the heap as they grow.
+	class BindingIdSet final
+	{
+		public:
+			/// Inserts an identifier into the set.
+			/// @param id The identifier. Must not be 0.
+			/// @returns True if the identifier was inserted, false if it was already present.
+			bool Insert(BindingId const id)
+			{
+				if ((count + 1) * 2 > slots.Size())
+				{
+					Rehash(slots.Empty() ? InlineSlotCapacity : slots.Size() * 2);
+				}
+
+				auto const mask = slots.Size() - 1;
+				for (auto index = Hash(id) & mask; ; index = (index + 1) & mask)
+				{
+					if (slots[index] == id)
+					{
+						return false;
+					}
+
+					if (slots[index] == EmptySlot)
+					{
+						slots[index] = id;
+						++count;
+
+						return true;
+					}
+				}
+			}
+
+			/// Removes an identifier from the set, if present.
+			/// @param id The identifier.
+			void Erase(BindingId const id) noexcept
+			{
+				auto const index = Find(id);
+				if (!index.has_value())
+				{
+					return;
+				}
+
+				// Backward shift deletion keeps every probe sequence unbroken without tombstones.
+				auto const mask = slots.Size() - 1;
+				auto hole = *index;
+				for (auto next = (hole + 1) & mask; slots[next] != EmptySlot; next = (next + 1) & mask)
+				{
+					auto const home = Hash(slots[next]) & mask;
+					auto const isHomeBetweenHoleAndNext = hole <= next
+						? hole < home && home <= next
+						: hole < home || home <= next;
+
+					if (!isHomeBetweenHoleAndNext)
+					{
+						slots[hole] = slots[next];
+						hole = next;
+					}
+				}
+
+				slots[hole] = EmptySlot;
+				--count;
+			}
+
+			/// Checks whether the set contains an identifier.
+			/// @param id The identifier.
+			/// @returns True if the set contains the identifier, false otherwise.
+			[[nodiscard]] bool Contains(BindingId const id) const noexcept
+			{
+				return Find(id).has_value();
+			}
+
+			/// Gets the number of identifiers in the set.
+			/// @returns The number of identifiers in the set.
+			[[nodiscard]] std::size_t Size() const noexcept
+			{
+				return count;
+			}
+
+		private:
+			static constexpr BindingId EmptySlot = 0;
+			static constexpr std::size_t InlineSlotCapacity = 32;
+
+			SmallVector<BindingId, InlineSlotCapacity> slots{};
+			std::size_t count = 0;
+
+			[[nodiscard]] static std::size_t Hash(BindingId const id) noexcept
+			{
+				// Fibonacci hashing spreads sequential identifiers across the table.
+				return static_cast<std::size_t>((id * 0x9E3779B97F4A7C15ull) >> 32);
+			}
+
+			[[nodiscard]] std::optional<std::size_t> Find(BindingId const id) const noexcept
+			{
+				if (slots.Empty())
+				{
+					return std::nullopt;
+				}
+
+				auto const mask = slots.Size() - 1;
+				for (auto index = Hash(id) & mask; slots[index] != EmptySlot; index = (index + 1) & mask)
+				{
+					if (slots[index] == id)
+					{
+						return index;
+					}
+				}
+
+				return std::nullopt;
+			}
+
+			void Rehash(std::size_t const newSlotCount)
+			{
+				auto newSlots = SmallVector<BindingId, InlineSlotCapacity>();
+				newSlots.Reserve(newSlotCount);
+
+				for (auto i = std::size_t(0); i < newSlotCount; ++i)
+				{
+					newSlots.EmplaceBack(EmptySlot);
+				}
+
+				auto const mask = newSlotCount - 1;
+				for (auto const id : slots)
+				{
+					if (id != EmptySlot)
+					{
+						auto index = Hash(id) & mask;
+						while (newSlots[index] != EmptySlot)
+						{
+							index = (index + 1) & mask;
+						}
+
+						newSlots[index] = id;
+					}
+				}
+
+				slots = std::move(newSlots);
+			}
+	};
+}
+
+#endif // SERUM_INTERNAL_BINDING_ID_SET_HPP
@@ -0,0 +1,91 @@
+/// @file Config.hpp
+/// Contains the version and configuration macros shared across Serum header files.
+/// This header does not include any standard library headers.
+
+#ifndef SERUM_INTERNAL_CONFIG_HPP
+#define SERUM_INTERNAL_CONFIG_HPP
+
+/// Indicates that Serum has been included.
+#define SERUM
+
+/// The major component of this version of Serum.
+#define SERUM_VERSION_MAJOR 0
+
+/// The minor component of this version of Serum.
+#define SERUM_VERSION_MINOR 3
+
+/// The patch component of this version of Serum.
+#define SERUM_VERSION_PATCH 0
+
+#if !defined(SERUM_DISABLE_COROUTINES) && defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+/// Indicates that Serum has been compiled with C++20 coroutine support.
+/// Define SERUM_DISABLE_COROUTINES to opt out.
+#define SERUM_HAS_COROUTINES
+#endif
+
+#ifndef SERUM_DISABLE_OBSERVERS
+/// Indicates that resolutions can be observed with a SerumObserver.
+/// Define SERUM_DISABLE_OBSERVERS to remove the observer hooks entirely.
+#define SERUM_HAS_OBSERVERS
+#endif
+
+#if defined(SERUM_HAS_OBSERVERS) && !defined(SERUM_DISABLE_PERF_EVENTS) && defined(__linux__) && __has_include(<linux/perf_event.h>)
+/// Indicates that bindings can be profiled with Linux perf_event hardware counters by an Observers::HardwareCounterProfiler.
+/// Define SERUM_DISABLE_PERF_EVENTS to opt out.
+#define SERUM_HAS_PERF_EVENTS
+#endif
+
+#if !defined(SERUM_DISABLE_TRACEPOINTS) && defined(__linux__) && (defined(__GNUC__) || defined(__clang__)) \
+	&& (defined(__x86_64__) || defined(__aarch64__))
+/// Indicates that Serum has been compiled with static tracepoints which tracers such as bpftrace, perf and SystemTap can attach to.
+/// Define SERUM_DISABLE_TRACEPOINTS to opt out.
+#define SERUM_HAS_TRACEPOINTS
+#endif
+
+#if !defined(SERUM_DISABLE_SHARED_MEMORY) && (defined(__linux__) || defined(__APPLE__)) && __has_include(<sys/mman.h>)
+/// Indicates that binding statistics can be exported to POSIX shared memory with a Metrics::SharedMemoryExporter.
+/// Define SERUM_DISABLE_SHARED_MEMORY to opt out.
+#define SERUM_HAS_SHARED_MEMORY
+#endif
+
+/// Resolution tracking level which records nothing. Cycles are not detected and the resolution path is always empty.
+#define SERUM_RESOLUTION_TRACKING_NONE 0
+
+/// Resolution tracking level which only records the bindings needed to detect cycles.
+/// The resolution path is always empty.
+#define SERUM_RESOLUTION_TRACKING_CYCLES 1
+
+/// Resolution tracking level which records the full resolution path and detects cycles.
+#define SERUM_RESOLUTION_TRACKING_FULL 2
+
+#ifndef SERUM_RESOLUTION_TRACKING
+/// The resolution tracking level. Define this as one of the SERUM_RESOLUTION_TRACKING_* values before
+/// including Serum to change it. It must be the same in every translation unit of a program.
+#define SERUM_RESOLUTION_TRACKING SERUM_RESOLUTION_TRACKING_FULL
+#endif
+
+// Define SERUM_ENABLE_METRICS before including Serum to record the resolution metrics of every binding,
+// which are available from SerumContainer::GetStatistics. It must be the same in every translation unit of a program.
+// When it is not defined, no metrics are stored or recorded.
+
+#if defined(__GNUC__) || defined(__clang__)
+/// Prevents a function from being inlined, so that it is emitted once rather than at every call site.
+#define SERUM_NOINLINE __attribute__((noinline))
+
+/// Marks a function as unlikely to be called, so that it is placed away from hot code.
+#define SERUM_COLD __attribute__((cold))
+#elif defined(_MSC_VER)
+/// Prevents a function from being inlined, so that it is emitted once rather than at every call site.
+#define SERUM_NOINLINE __declspec(noinline)
+
+/// Marks a function as unlikely to be called, so that it is placed away from hot code.
+#define SERUM_COLD
+#else
+/// Prevents a function from being inlined, so that it is emitted once rather than at every call site.
+#define SERUM_NOINLINE
+
+/// Marks a function as unlikely to be called, so that it is placed away from hot code.
+#define SERUM_COLD
+#endif
+
+#endif // SERUM_INTERNAL_CONFIG_HPP
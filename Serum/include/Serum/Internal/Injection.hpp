@@ -0,0 +1,174 @@
+/// @file Injection.hpp
+/// Defines functions which construct types by injecting their declared dependencies into their constructor.
+
+#ifndef SERUM_INTERNAL_INJECTION_HPP
+#define SERUM_INTERNAL_INJECTION_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/TypeTraits.hpp"
+#include "Serum/Dependencies.hpp"
+#include "Serum/ResolutionContext.hpp"
+
+#include <tuple>
+
+namespace Serum::Internal
+{
+	/// Checks whether or not the type T can be constructed from the given dependencies.
+	/// @tparam T The type to check.
+	/// @tparam TDependencies The Dependencies list.
+	template <typename T, typename TDependencies>
+	struct IsConstructibleFromDependencies;
+
+	/// Checks whether or not the type T can be constructed from the given dependencies.
+	/// @tparam T The type to check.
+	/// @tparam TDependencies The request types of the dependencies.
+	template <typename T, typename... TDependencies>
+	struct IsConstructibleFromDependencies<T, Dependencies<TDependencies...>>
+		: std::is_constructible<T, TDependencies...> {};
+
+	/// Checks whether or not the type T can be constructed by injecting its declared SerumDependencies, or by
+	/// default construction if it does not declare any.
+	/// @tparam T The type to check.
+	template <typename T>
+	struct IsInjectable final : IsConstructibleFromDependencies<T, typename DependenciesOf<T>::Type> {};
+
+	/// Resolves each dependency from the container, in the order they are declared.
+	/// @tparam TContainer The type of the container to resolve the dependencies from.
+	/// @tparam TDependencies The request types of the dependencies.
+	/// @param container The container.
+	/// @param resolutionContext The resolution context.
+	/// @returns The resolved dependencies.
+	template <typename TContainer, typename... TDependencies>
+	[[nodiscard]] std::tuple<TDependencies...> ResolveDependencies(
+		TContainer& container,
+		ResolutionContext& resolutionContext,
+		Dependencies<TDependencies...>)
+	{
+		// The elements of a braced initializer list are evaluated from left to right, unlike function arguments.
+		return std::tuple<TDependencies...>{ container.template Get<TDependencies>(resolutionContext)... };
+	}
+
+	/// Resolves each dependency from the container and constructs an instance of T from them.
+	/// The dependencies are resolved in the order they are declared.
+	/// @tparam T The type to construct.
+	/// @tparam TContainer The type of the container to resolve the dependencies from.
+	/// @tparam TDependencies The request types of the dependencies.
+	/// @param container The container.
+	/// @param resolutionContext The resolution context.
+	/// @returns The new instance.
+	template <typename T, typename TContainer, typename... TDependencies>
+	[[nodiscard]] T Inject(TContainer& container, ResolutionContext& resolutionContext, Dependencies<TDependencies...>)
+	{
+		return std::apply(
+			[](auto&&... dependencies) { return T(std::forward<decltype(dependencies)>(dependencies)...); },
+			ResolveDependencies(container, resolutionContext, Dependencies<TDependencies...>()));
+	}
+
+	/// Resolves each dependency from the container and constructs a heap-allocated instance of T from them.
+	/// The dependencies are resolved in the order they are declared.
+	/// @tparam T The type to construct.
+	/// @tparam TContainer The type of the container to resolve the dependencies from.
+	/// @tparam TDependencies The request types of the dependencies.
+	/// @param container The container.
+	/// @param resolutionContext The resolution context.
+	/// @returns The new instance, which must be deleted by the caller.
+	template <typename T, typename TContainer, typename... TDependencies>
+	[[nodiscard]] T* InjectNew(TContainer& container, ResolutionContext& resolutionContext, Dependencies<TDependencies...>)
+	{
+		if constexpr (sizeof...(TDependencies) == 0)
+		{
+			return new T;
+		}
+		else
+		{
+			return std::apply(
+				[](auto&&... dependencies) { return new T(std::forward<decltype(dependencies)>(dependencies)...); },
+				ResolveDependencies(container, resolutionContext, Dependencies<TDependencies...>()));
+		}
+	}
+
+	/// Resolves each dependency from the container and makes a shared pointer to an instance of T constructed from them.
+	/// The dependencies are resolved in the order they are declared.
+	/// @tparam T The type to construct.
+	/// @tparam TContainer The type of the container to resolve the dependencies from.
+	/// @tparam TDependencies The request types of the dependencies.
+	/// @param container The container.
+	/// @param resolutionContext The resolution context.
+	/// @returns The new instance.
+	template <typename T, typename TContainer, typename... TDependencies>
+	[[nodiscard]] std::shared_ptr<T> InjectShared(
+		TContainer& container,
+		ResolutionContext& resolutionContext,
+		Dependencies<TDependencies...>)
+	{
+		return std::apply(
+			[](auto&&... dependencies) { return std::make_shared<T>(std::forward<decltype(dependencies)>(dependencies)...); },
+			ResolveDependencies(container, resolutionContext, Dependencies<TDependencies...>()));
+	}
+
+	/// Checks at compile time that the type T can be constructed from its declared dependencies.
+	/// @tparam T The type to check.
+	template <typename T>
+	constexpr void AssertInjectable() noexcept
+	{
+		if constexpr (HasSerumDependencies<T>::value)
+		{
+			static_assert(
+				IsInjectable<T>::value,
+				"Could not inject dependencies - Type must be constructable from its declared SerumDependencies.");
+		}
+		else
+		{
+			static_assert(
+				std::is_default_constructible<T>::value,
+				"Could not bind type to self - Type must be default constructable.");
+		}
+	}
+
+	/// Constructs an instance of T by injecting its declared dependencies, or by default construction if it
+	/// does not declare any.
+	/// @tparam T The type to construct.
+	/// @tparam TContainer The type of the container to resolve the dependencies from.
+	/// @param container The container.
+	/// @param resolutionContext The resolution context.
+	/// @returns The new instance.
+	template <typename T, typename TContainer>
+	[[nodiscard]] T Construct(TContainer& container, ResolutionContext& resolutionContext)
+	{
+		AssertInjectable<T>();
+
+		return Inject<T>(container, resolutionContext, typename DependenciesOf<T>::Type());
+	}
+
+	/// Constructs a heap-allocated instance of T by injecting its declared dependencies, or by default construction
+	/// if it does not declare any.
+	/// @tparam T The type to construct.
+	/// @tparam TContainer The type of the container to resolve the dependencies from.
+	/// @param container The container.
+	/// @param resolutionContext The resolution context.
+	/// @returns The new instance, which must be deleted by the caller.
+	template <typename T, typename TContainer>
+	[[nodiscard]] T* ConstructNew(TContainer& container, ResolutionContext& resolutionContext)
+	{
+		AssertInjectable<T>();
+
+		return InjectNew<T>(container, resolutionContext, typename DependenciesOf<T>::Type());
+	}
+
+	/// Makes a shared pointer to an instance of T by injecting its declared dependencies, or by default construction
+	/// if it does not declare any.
+	/// @tparam T The type to construct.
+	/// @tparam TContainer The type of the container to resolve the dependencies from.
+	/// @param container The container.
+	/// @param resolutionContext The resolution context.
+	/// @returns The new instance.
+	template <typename T, typename TContainer>
+	[[nodiscard]] std::shared_ptr<T> ConstructShared(TContainer& container, ResolutionContext& resolutionContext)
+	{
+		AssertInjectable<T>();
+
+		return InjectShared<T>(container, resolutionContext, typename DependenciesOf<T>::Type());
+	}
+}
+
+#endif // SERUM_INTERNAL_INJECTION_HPP
@@ -0,0 +1,53 @@
+/// @file Json.hpp
+/// Defines helpers for writing JSON documents.
+
+#ifndef SERUM_INTERNAL_JSON_HPP
+#define SERUM_INTERNAL_JSON_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+namespace Serum::Internal
+{
+	/// Quotes a string as a JSON string, escaping it as needed.
+	/// @param value The string.
+	/// @returns The quoted JSON string.
+	[[nodiscard]] inline std::string ToJsonString(std::string const& value)
+	{
+		constexpr char const* hexDigits = "0123456789abcdef";
+
+		auto json = std::string();
+		json.reserve(value.size() + 2);
+		json += '"';
+
+		for (auto const character : value)
+		{
+			switch (character)
+			{
+				case '"': json += "\\\""; break;
+				case '\\': json += "\\\\"; break;
+				case '\b': json += "\\b"; break;
+				case '\f': json += "\\f"; break;
+				case '\n': json += "\\n"; break;
+				case '\r': json += "\\r"; break;
+				case '\t': json += "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(character) < 0x20)
+					{
+						json += "\\u00";
+						json += hexDigits[(character >> 4) & 0xF];
+						json += hexDigits[character & 0xF];
+					}
+					else
+					{
+						json += character;
+					}
+			}
+		}
+
+		json += '"';
+
+		return json;
+	}
+}
+
+#endif // SERUM_INTERNAL_JSON_HPP
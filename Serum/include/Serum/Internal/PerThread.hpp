@@ -0,0 +1,290 @@
+/// @file PerThread.hpp
+/// Defines a container which gives each thread its own instance of some state.
+
+#ifndef SERUM_INTERNAL_PER_THREAD_HPP
+#define SERUM_INTERNAL_PER_THREAD_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Serum::Internal
+{
+	/// An entry in a thread's cache of the slots it owns.
+	struct PerThreadCacheEntry final
+	{
+		/// The identifier of the PerThread instance the slot belongs to, or 0 if the entry is empty.
+		std::uint64_t ownerId = 0;
+
+		/// The slot.
+		void* slot = nullptr;
+	};
+
+	/// A thread's cache of the slots it owns, with one entry for each PerThread index. It is trivially destructible,
+	/// so it can be used at any point in the thread's lifetime, and its entries are freed by a PerThreadCacheOwner.
+	struct PerThreadCache final
+	{
+		/// The entries, indexed by the index of the PerThread instance which owns the slot.
+		PerThreadCacheEntry* entries = nullptr;
+
+		/// The number of entries.
+		std::size_t size = 0;
+	};
+
+	/// Gets the calling thread's cache of the slots it owns. The cache is shared by every PerThread instance, and each
+	/// instance alive at the same time has its own entry, so instances never evict one another.
+	/// @returns The cache.
+	[[nodiscard]] inline PerThreadCache& GetPerThreadCache() noexcept
+	{
+		static thread_local auto cache = PerThreadCache();
+
+		return cache;
+	}
+
+	/// Frees the entries of the calling thread's cache when the thread exits.
+	class PerThreadCacheOwner final
+	{
+		public:
+			/// Initializes a new instance of the PerThreadCacheOwner class.
+			PerThreadCacheOwner() noexcept = default;
+
+			/// Deleted copy constructor.
+			PerThreadCacheOwner(PerThreadCacheOwner const&) = delete;
+
+			/// Deleted copy assignment operator.
+			PerThreadCacheOwner& operator=(PerThreadCacheOwner const&) = delete;
+
+			/// Frees the entries of the calling thread's cache.
+			~PerThreadCacheOwner()
+			{
+				auto& cache = GetPerThreadCache();
+				delete[] cache.entries;
+				cache = PerThreadCache();
+			}
+	};
+
+	/// Grows the calling thread's cache so that it has an entry for the given index. Existing entries are kept.
+	/// @param index The index of a PerThread instance.
+	/// @returns The entry for the index.
+	inline SERUM_NOINLINE PerThreadCacheEntry& GrowPerThreadCache(std::size_t const index)
+	{
+		static thread_local auto owner = PerThreadCacheOwner();
+		(void)owner;
+
+		auto& cache = GetPerThreadCache();
+		auto const size = std::max(index + 1, cache.size * 2);
+		auto entries = std::make_unique<PerThreadCacheEntry[]>(size);
+		std::copy(cache.entries, cache.entries + cache.size, entries.get());
+
+		delete[] cache.entries;
+		cache.entries = entries.release();
+		cache.size = size;
+
+		return cache.entries[index];
+	}
+
+	/// Assigns indices to PerThread instances. The indices of destroyed instances are reused, so they stay small and
+	/// every thread's cache only grows with the number of instances alive at once.
+	class PerThreadIndices final
+	{
+		public:
+			/// Gets the indices shared by every PerThread instance.
+			/// @returns The indices.
+			[[nodiscard]] static PerThreadIndices& Get() noexcept
+			{
+				static auto indices = PerThreadIndices();
+
+				return indices;
+			}
+
+			/// Gets an index which is not used by any other instance.
+			/// @returns The index.
+			[[nodiscard]] std::size_t Acquire()
+			{
+				auto const lock = std::lock_guard(mutex);
+				if (freeIndices.empty())
+				{
+					// There is room to release every index without allocating.
+					freeIndices.reserve(numberOfIndices + 1);
+
+					return numberOfIndices++;
+				}
+
+				auto const index = freeIndices.back();
+				freeIndices.pop_back();
+
+				return index;
+			}
+
+			/// Returns an index so that it can be used by a new instance.
+			/// @param index The index.
+			void Release(std::size_t const index) noexcept
+			{
+				auto const lock = std::lock_guard(mutex);
+				freeIndices.push_back(index);
+			}
+
+		private:
+			std::mutex mutex{};
+			std::size_t numberOfIndices = 0;
+			std::vector<std::size_t> freeIndices{};
+	};
+
+	/// Gets a new identifier for a PerThread instance. Instances are identified by a counter rather than their index,
+	/// so a thread's cached slot is never mistaken for one belonging to a new instance which reuses the index.
+	/// @returns The identifier.
+	[[nodiscard]] inline std::uint64_t NextPerThreadId() noexcept
+	{
+		static auto nextId = std::atomic<std::uint64_t>(1);
+
+		return nextId.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// Gives each thread its own instance of some state, so that threads can update their state without
+	/// contending with one another, and the states of every thread can be merged on demand.
+	/// @tparam TState The type of the state. It must be default constructible.
+	template <typename TState>
+	class PerThread final
+	{
+		public:
+			/// The state owned by one thread.
+			struct Slot final
+			{
+				/// The identifier of the thread which owns the slot.
+				std::thread::id threadId;
+
+				/// The index of the thread, starting from 1 in the order threads first used the PerThread instance.
+				std::size_t threadIndex;
+
+				/// Guards the state. It is only contended while the states are being read or cleared.
+				std::mutex mutex{};
+
+				/// The state.
+				TState state{};
+			};
+
+			/// Initializes a new instance of the PerThread class.
+			PerThread()
+				: id(NextPerThreadId()),
+				  index(PerThreadIndices::Get().Acquire())
+			{
+			}
+
+			/// Destroys the PerThread instance, allowing its index to be reused.
+			~PerThread()
+			{
+				PerThreadIndices::Get().Release(index);
+			}
+
+			/// Deleted copy constructor.
+			PerThread(PerThread const&) = delete;
+
+			/// Deleted copy assignment operator.
+			PerThread& operator=(PerThread const&) = delete;
+
+			/// Gets the calling thread's slot, creating it the first time the thread uses this instance. Only the first
+			/// call on each thread locks; later calls find the slot in the thread's cache.
+			/// @returns The slot. It is valid for the lifetime of this instance.
+			[[nodiscard]] Slot& GetLocal()
+			{
+				auto const& cache = GetPerThreadCache();
+				if (index < cache.size && cache.entries[index].ownerId == id)
+				{
+					return *static_cast<Slot*>(cache.entries[index].slot);
+				}
+
+				return GetLocalSlow();
+			}
+
+			/// Gets the index of this instance in each thread's cache. Instances alive at the same time have distinct indices.
+			/// @returns The index.
+			[[nodiscard]] std::size_t GetIndex() const noexcept
+			{
+				return index;
+			}
+
+			/// Calls a function with every thread's slot, in the order the threads were registered, while holding the slot's mutex.
+			/// @tparam TFunction The type of the function.
+			/// @param function The function, which is called with a Slot&.
+			template <typename TFunction>
+			void ForEach(TFunction&& function)
+			{
+				auto const registryLock = std::lock_guard(registryMutex);
+
+				for (auto const& slot : slots)
+				{
+					auto const lock = std::lock_guard(slot->mutex);
+					function(*slot);
+				}
+			}
+
+			/// Calls a function with every thread's slot, in the order the threads were registered, while holding the slot's mutex.
+			/// @tparam TFunction The type of the function.
+			/// @param function The function, which is called with a Slot const&.
+			template <typename TFunction>
+			void ForEach(TFunction&& function) const
+			{
+				auto const registryLock = std::lock_guard(registryMutex);
+
+				for (auto const& slot : slots)
+				{
+					auto const lock = std::lock_guard(slot->mutex);
+					function(static_cast<Slot const&>(*slot));
+				}
+			}
+
+			/// Gets the number of threads which have used this instance.
+			/// @returns The number of threads.
+			[[nodiscard]] std::size_t GetNumberOfThreads() const
+			{
+				auto const registryLock = std::lock_guard(registryMutex);
+
+				return slots.size();
+			}
+
+		private:
+			std::uint64_t id;
+			std::size_t index;
+			mutable std::mutex registryMutex{};
+			std::vector<std::unique_ptr<Slot>> slots{};
+
+			SERUM_NOINLINE Slot& GetLocalSlow()
+			{
+				auto& slot = Register();
+				auto& cache = GetPerThreadCache();
+				auto& entry = index < cache.size ? cache.entries[index] : GrowPerThreadCache(index);
+				entry.slot = &slot;
+				entry.ownerId = id;
+
+				return slot;
+			}
+
+			SERUM_NOINLINE Slot& Register()
+			{
+				auto const threadId = std::this_thread::get_id();
+				auto const registryLock = std::lock_guard(registryMutex);
+
+				for (auto const& slot : slots)
+				{
+					if (slot->threadId == threadId)
+					{
+						return *slot;
+					}
+				}
+
+				auto slot = std::make_unique<Slot>();
+				slot->threadId = threadId;
+				slot->threadIndex = slots.size() + 1;
+				slots.push_back(std::move(slot));
+
+				return *slots.back();
+			}
+	};
+}
+
+#endif // SERUM_INTERNAL_PER_THREAD_HPP
@@ -0,0 +1,53 @@
+/// @file ResolutionPathEntry.hpp
+/// Defines a compact, fixed-size identifier for a binding in a resolution path.
+
+#ifndef SERUM_INTERNAL_RESOLUTION_PATH_ENTRY_HPP
+#define SERUM_INTERNAL_RESOLUTION_PATH_ENTRY_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/BindingIdSet.hpp"
+#include "Serum/Bindings/BindingKey.hpp"
+
+namespace Serum::Internal
+{
+	/// A compact, fixed-size identifier for a binding in a resolution path. Unlike BindingKey,
+	/// it does not own a copy of the binding name, so it is cheap to copy, and entries are compared as integers.
+	/// An entry refers to the key of the binding being resolved, which outlives the entry's place in the path.
+	struct ResolutionPathEntry final
+	{
+		/// The identifier of the binding.
+		BindingId bindingId;
+
+		/// The hash of the binding's key, which is compared before the key itself.
+		std::size_t keyHash;
+
+		/// The key of the binding.
+		Bindings::BindingKey const* key;
+
+		/// Equality operator for resolution path entries.
+		/// @param other The other entry.
+		/// @returns True if the entries identify the same binding, false otherwise.
+		bool operator==(ResolutionPathEntry const& other) const noexcept
+		{
+			return bindingId == other.bindingId;
+		}
+
+		/// Checks whether the entry identifies a binding with the given key.
+		/// @param otherKey The key.
+		/// @param otherKeyHash The hash of the key.
+		/// @returns True if the entry's key is the given key, false otherwise.
+		[[nodiscard]] bool HasKey(Bindings::BindingKey const& otherKey, std::size_t const otherKeyHash) const noexcept
+		{
+			return keyHash == otherKeyHash && *key == otherKey;
+		}
+
+		/// Converts the entry back to a binding key.
+		/// @returns The binding key.
+		[[nodiscard]] Bindings::BindingKey ToBindingKey() const
+		{
+			return *key;
+		}
+	};
+}
+
+#endif // SERUM_INTERNAL_RESOLUTION_PATH_ENTRY_HPP
@@ -0,0 +1,159 @@
+/// @file SharedMemoryMapping.hpp
+/// Defines an owner of a POSIX shared memory object mapped into the process.
+
+#ifndef SERUM_INTERNAL_SHARED_MEMORY_MAPPING_HPP
+#define SERUM_INTERNAL_SHARED_MEMORY_MAPPING_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+#ifdef SERUM_HAS_SHARED_MEMORY
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Serum::Internal
+{
+	/// Maps a POSIX shared memory object, such as /dev/shm/name on Linux, into the process, and unmaps it when destroyed.
+	class SharedMemoryMapping final
+	{
+		public:
+			/// Creates a shared memory object, replacing any existing object with the same name, and maps it for writing.
+			/// The object is removed when the mapping is destroyed.
+			/// @param name The name of the object, starting with a slash.
+			/// @param size The size of the object in bytes. The object is zero-filled.
+			/// @returns The mapping.
+			/// @throws SerumException If the object cannot be created or mapped.
+			[[nodiscard]] static SharedMemoryMapping Create(std::string const& name, std::size_t const size)
+			{
+				::shm_unlink(name.c_str());
+
+				auto const descriptor = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+				if (descriptor == -1)
+				{
+					ThrowSystemError("Could not create shared memory object " + name);
+				}
+
+				if (::ftruncate(descriptor, static_cast<off_t>(size)) != 0)
+				{
+					auto const error = errno;
+					::close(descriptor);
+					::shm_unlink(name.c_str());
+					errno = error;
+					ThrowSystemError("Could not resize shared memory object " + name);
+				}
+
+				return SharedMemoryMapping(name, descriptor, size, PROT_READ | PROT_WRITE, true);
+			}
+
+			/// Maps an existing shared memory object for reading.
+			/// @param name The name of the object, starting with a slash.
+			/// @returns The mapping.
+			/// @throws SerumException If the object does not exist or cannot be mapped.
+			[[nodiscard]] static SharedMemoryMapping Open(std::string const& name)
+			{
+				auto const descriptor = ::shm_open(name.c_str(), O_RDONLY, 0);
+				if (descriptor == -1)
+				{
+					ThrowSystemError("Could not open shared memory object " + name);
+				}
+
+				struct stat status{};
+				if (::fstat(descriptor, &status) != 0)
+				{
+					::close(descriptor);
+					ThrowSystemError("Could not get the size of shared memory object " + name);
+				}
+
+				return SharedMemoryMapping(name, descriptor, static_cast<std::size_t>(status.st_size), PROT_READ, false);
+			}
+
+			/// Deleted copy constructor.
+			SharedMemoryMapping(SharedMemoryMapping const&) = delete;
+
+			/// Move constructor.
+			/// @param mapping The mapping to move.
+			SharedMemoryMapping(SharedMemoryMapping&& mapping) noexcept
+				: name(std::move(mapping.name)),
+				  address(std::exchange(mapping.address, nullptr)),
+				  size(std::exchange(mapping.size, 0)),
+				  isOwner(std::exchange(mapping.isOwner, false))
+			{
+			}
+
+			/// Unmaps the object, and removes it if this mapping created it.
+			~SharedMemoryMapping()
+			{
+				if (address != nullptr)
+				{
+					::munmap(address, size);
+				}
+
+				if (isOwner)
+				{
+					::shm_unlink(name.c_str());
+				}
+			}
+
+			/// Deleted copy assignment operator.
+			SharedMemoryMapping& operator=(SharedMemoryMapping const&) = delete;
+
+			/// Deleted move assignment operator.
+			SharedMemoryMapping& operator=(SharedMemoryMapping&&) = delete;
+
+			/// Gets the address the object is mapped at.
+			/// @returns The address.
+			[[nodiscard]] void* GetAddress() const noexcept
+			{
+				return address;
+			}
+
+			/// Gets the size of the object.
+			/// @returns The size in bytes.
+			[[nodiscard]] std::size_t GetSize() const noexcept
+			{
+				return size;
+			}
+
+		private:
+			std::string name;
+			void* address;
+			std::size_t size;
+			bool isOwner;
+
+			SharedMemoryMapping(std::string const& name, int const descriptor, std::size_t const size, int const protection, bool const isOwner)
+				: name(name), address(nullptr), size(size), isOwner(isOwner)
+			{
+				// The mapping keeps the object alive, so the descriptor is not needed once it is mapped.
+				auto* const mapped = size == 0 ? MAP_FAILED : ::mmap(nullptr, size, protection, MAP_SHARED, descriptor, 0);
+				auto const error = errno;
+				::close(descriptor);
+
+				if (mapped == MAP_FAILED)
+				{
+					if (isOwner)
+					{
+						::shm_unlink(name.c_str());
+					}
+
+					errno = size == 0 ? EINVAL : error;
+					ThrowSystemError("Could not map shared memory object " + name);
+				}
+
+				address = mapped;
+			}
+
+			[[noreturn]] static void ThrowSystemError(std::string const& message)
+			{
+				throw SerumException(message + ": " + std::strerror(errno));
+			}
+	};
+}
+
+#endif // SERUM_HAS_SHARED_MEMORY
+
+#endif // SERUM_INTERNAL_SHARED_MEMORY_MAPPING_HPP
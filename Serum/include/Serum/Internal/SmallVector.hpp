@@ -0,0 +1,270 @@
+/// @file SmallVector.hpp
+/// Defines a vector type which stores a small number of elements inline before spilling to the heap.
+
+#ifndef SERUM_INTERNAL_SMALL_VECTOR_HPP
+#define SERUM_INTERNAL_SMALL_VECTOR_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+#include <new>
+
+namespace Serum::Internal
+{
+	/// A vector which stores up to InlineCapacity elements inline, only allocating
+	/// on the heap once that capacity is exceeded.
+	/// @tparam T The element type.
+	/// @tparam InlineCapacity The number of elements stored inline.
+	template <typename T, std::size_t InlineCapacity>
+	class SmallVector final
+	{
+		static_assert(InlineCapacity > 0, "SmallVector must have a non-zero inline capacity.");
+
+		public:
+			/// Initializes a new, empty instance of the SmallVector class.
+			SmallVector() noexcept
+				: elements(InlineData())
+			{
+			}
+
+			/// Copy constructor.
+			/// @param other The vector to copy.
+			SmallVector(SmallVector const& other)
+				: elements(InlineData())
+			{
+				Reserve(other.count);
+
+				for (auto const& element : other)
+				{
+					EmplaceBack(element);
+				}
+			}
+
+			/// Move constructor.
+			/// @param other The vector to move.
+			SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+				: elements(InlineData())
+			{
+				MoveFrom(other);
+			}
+
+			/// Destroys the elements and releases any heap storage.
+			~SmallVector()
+			{
+				Clear();
+				ReleaseHeapStorage();
+			}
+
+			/// Copy assignment operator.
+			/// @param other The vector to copy.
+			SmallVector& operator=(SmallVector const& other)
+			{
+				if (this != &other)
+				{
+					Clear();
+					Reserve(other.count);
+
+					for (auto const& element : other)
+					{
+						EmplaceBack(element);
+					}
+				}
+
+				return *this;
+			}
+
+			/// Move assignment operator.
+			/// @param other The vector to move.
+			SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+			{
+				if (this != &other)
+				{
+					Clear();
+					ReleaseHeapStorage();
+					MoveFrom(other);
+				}
+
+				return *this;
+			}
+
+			/// Constructs an element in place at the end of the vector.
+			/// @param arguments The arguments to construct the element with.
+			/// @returns The new element.
+			template <typename... TArguments>
+			T& EmplaceBack(TArguments&&... arguments)
+			{
+				if (count == capacity)
+				{
+					Reserve(capacity * 2);
+				}
+
+				auto* const element = ::new (static_cast<void*>(elements + count)) T(std::forward<TArguments>(arguments)...);
+				++count;
+
+				return *element;
+			}
+
+			/// Removes the last element. The vector must not be empty.
+			void PopBack() noexcept
+			{
+				--count;
+				elements[count].~T();
+			}
+
+			/// Destroys all elements, retaining any allocated storage.
+			void Clear() noexcept
+			{
+				while (count > 0)
+				{
+					PopBack();
+				}
+			}
+
+			/// Ensures the vector can store at least the given number of elements without reallocating.
+			/// @param newCapacity The required capacity.
+			void Reserve(std::size_t const newCapacity)
+			{
+				if (newCapacity <= capacity)
+				{
+					return;
+				}
+
+				auto* const newElements = std::allocator<T>().allocate(newCapacity);
+
+				for (auto i = std::size_t(0); i < count; ++i)
+				{
+					::new (static_cast<void*>(newElements + i)) T(std::move_if_noexcept(elements[i]));
+					elements[i].~T();
+				}
+
+				ReleaseHeapStorage();
+				elements = newElements;
+				capacity = newCapacity;
+			}
+
+			/// Gets the element at the given index.
+			/// @param index The index.
+			/// @returns The element.
+			[[nodiscard]] T& operator[](std::size_t const index) noexcept
+			{
+				return elements[index];
+			}
+
+			/// Gets the element at the given index.
+			/// @param index The index.
+			/// @returns The element.
+			[[nodiscard]] T const& operator[](std::size_t const index) const noexcept
+			{
+				return elements[index];
+			}
+
+			/// Gets the last element. The vector must not be empty.
+			/// @returns The last element.
+			[[nodiscard]] T& Back() noexcept
+			{
+				return elements[count - 1];
+			}
+
+			/// Gets the last element. The vector must not be empty.
+			/// @returns The last element.
+			[[nodiscard]] T const& Back() const noexcept
+			{
+				return elements[count - 1];
+			}
+
+			/// Gets the number of elements.
+			/// @returns The number of elements.
+			[[nodiscard]] std::size_t Size() const noexcept
+			{
+				return count;
+			}
+
+			/// Checks whether the vector is empty.
+			/// @returns True if the vector has no elements, false otherwise.
+			[[nodiscard]] bool Empty() const noexcept
+			{
+				return count == 0;
+			}
+
+			/// Checks whether the elements have spilled from inline storage onto the heap.
+			/// @returns True if the elements are stored on the heap, false otherwise.
+			[[nodiscard]] bool IsOnHeap() const noexcept
+			{
+				return elements != InlineData();
+			}
+
+			/// Gets an iterator to the first element.
+			/// @returns An iterator to the first element.
+			[[nodiscard]] T* begin() noexcept
+			{
+				return elements;
+			}
+
+			/// Gets an iterator past the last element.
+			/// @returns An iterator past the last element.
+			[[nodiscard]] T* end() noexcept
+			{
+				return elements + count;
+			}
+
+			/// Gets an iterator to the first element.
+			/// @returns An iterator to the first element.
+			[[nodiscard]] T const* begin() const noexcept
+			{
+				return elements;
+			}
+
+			/// Gets an iterator past the last element.
+			/// @returns An iterator past the last element.
+			[[nodiscard]] T const* end() const noexcept
+			{
+				return elements + count;
+			}
+
+		private:
+			alignas(T) unsigned char inlineStorage[sizeof(T) * InlineCapacity];
+			T* elements;
+			std::size_t count = 0;
+			std::size_t capacity = InlineCapacity;
+
+			[[nodiscard]] T* InlineData() noexcept
+			{
+				return reinterpret_cast<T*>(inlineStorage);
+			}
+
+			[[nodiscard]] T const* InlineData() const noexcept
+			{
+				return reinterpret_cast<T const*>(inlineStorage);
+			}
+
+			void ReleaseHeapStorage() noexcept
+			{
+				if (IsOnHeap())
+				{
+					std::allocator<T>().deallocate(elements, capacity);
+					elements = InlineData();
+					capacity = InlineCapacity;
+				}
+			}
+
+			void MoveFrom(SmallVector& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+			{
+				if (other.IsOnHeap())
+				{
+					elements = std::exchange(other.elements, other.InlineData());
+					count = std::exchange(other.count, 0);
+					capacity = std::exchange(other.capacity, InlineCapacity);
+
+					return;
+				}
+
+				for (auto& element : other)
+				{
+					EmplaceBack(std::move(element));
+				}
+
+				other.Clear();
+			}
+	};
+}
+
+#endif // SERUM_INTERNAL_SMALL_VECTOR_HPP
@@ -0,0 +1,67 @@
+/// @file Tracepoints.hpp
+/// Defines static tracepoints which tracers such as bpftrace, perf and SystemTap can attach to at runtime.
+
+#ifndef SERUM_INTERNAL_TRACEPOINTS_HPP
+#define SERUM_INTERNAL_TRACEPOINTS_HPP
+
+#include "Serum/Internal/Config.hpp"
+
+#ifdef SERUM_HAS_TRACEPOINTS
+
+#include <type_traits>
+
+namespace Serum::Internal
+{
+	/// Gets the size of a tracepoint argument in the form expected by tracers: negative for signed types.
+	/// The tracepoint prints the negation of this value, as in <sys/sdt.h>.
+	/// @tparam TArgument The type of the argument.
+	/// @returns The negated signed size of the argument.
+	template <typename TArgument>
+	[[nodiscard]] constexpr int GetTracepointArgumentSize() noexcept
+	{
+		using Argument = std::decay_t<TArgument>;
+
+		return std::is_signed_v<Argument> ? static_cast<int>(sizeof(Argument)) : -static_cast<int>(sizeof(Argument));
+	}
+}
+
+/// Defines a tracepoint in the "serum" provider, with the binding's request type name and binding name as its arguments.
+/// The tracepoint is a single nop instruction, described by an ELF note in the same format as the SystemTap <sys/sdt.h>
+/// probes, so it costs nothing until a tracer replaces the nop with a breakpoint. The arguments are passed as operands
+/// of the nop, so the compiler only needs them to be addressable, typically in a register or at an offset from one.
+/// @param name The name of the tracepoint.
+/// @param typeName The request type name of the binding, as a const char*.
+/// @param bindingName The name of the binding, as a const char*.
+#define SERUM_TRACEPOINT(name, typeName, bindingName) \
+	__asm__ __volatile__( \
+		"990: nop\n" \
+		".pushsection .note.stapsdt,\"?\",\"note\"\n" \
+		".balign 4\n" \
+		".4byte 992f-991f, 994f-993f, 3\n" \
+		"991: .asciz \"stapsdt\"\n" \
+		"992: .balign 4\n" \
+		"993: .8byte 990b\n" \
+		".8byte _.stapsdt.base\n" \
+		".8byte 0\n" \
+		".asciz \"serum\"\n" \
+		".asciz \"" #name "\"\n" \
+		".asciz \"%n[TypeNameSize]@%[TypeName] %n[BindingNameSize]@%[BindingName]\"\n" \
+		"994: .balign 4\n" \
+		".popsection\n" \
+		".ifndef _.stapsdt.base\n" \
+		".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+		".weak _.stapsdt.base\n" \
+		".hidden _.stapsdt.base\n" \
+		"_.stapsdt.base: .space 1\n" \
+		".size _.stapsdt.base, 1\n" \
+		".popsection\n" \
+		".endif\n" \
+		: \
+		: [TypeNameSize] "n"(::Serum::Internal::GetTracepointArgumentSize<decltype(typeName)>()), \
+		  [TypeName] "nor"(typeName), \
+		  [BindingNameSize] "n"(::Serum::Internal::GetTracepointArgumentSize<decltype(bindingName)>()), \
+		  [BindingName] "nor"(bindingName))
+
+#endif // SERUM_HAS_TRACEPOINTS
+
+#endif // SERUM_INTERNAL_TRACEPOINTS_HPP
@@ -5,11 +5,10 @@
 #define SERUM_INTERNAL_TYPE_TRAITS_HPP
 
 #include "Serum/ResolutionContext.hpp"
+#include "Serum/Dependencies.hpp"
 
 namespace Serum
 {
-	class SerumContainer;
-
 	namespace Internal
 	{
 		/// The expected function pointer signature of a Serum constructor.
@@ -34,6 +33,44 @@ namespace Serum
 			public:
 			    static constexpr auto value = std::is_same<std::true_type, decltype(Test<T>(nullptr))>::value;
 		};
+
+		/// Checks whether or not the type T declares its dependencies with a SerumDependencies alias.
+		/// @tparam T The type to check.
+		template <typename T, typename = void>
+		struct HasSerumDependencies final : std::false_type {};
+
+		/// Checks whether or not the type T declares its dependencies with a SerumDependencies alias.
+		/// @tparam T The type to check.
+		template <typename T>
+		struct HasSerumDependencies<T, std::void_t<typename T::SerumDependencies>> final : std::true_type {};
+
+		/// Gets the declared dependencies of the type T, or an empty Dependencies list if it does not declare any.
+		/// @tparam T The type.
+		template <typename T, bool = HasSerumDependencies<T>::value>
+		struct DependenciesOf final
+		{
+			/// The declared dependencies.
+			using Type = Dependencies<>;
+		};
+
+		/// Gets the declared dependencies of the type T, or an empty Dependencies list if it does not declare any.
+		/// @tparam T The type.
+		template <typename T>
+		struct DependenciesOf<T, true> final
+		{
+			/// The declared dependencies.
+			using Type = typename T::SerumDependencies;
+		};
+
+		/// Gets the dependencies resolved from the static container to construct the type T. A type with a Serum
+		/// constructor resolves its own dependencies, so none are, even if it also declares SerumDependencies.
+		/// @tparam T The type.
+		template <typename T>
+		struct ConstructorDependenciesOf final
+		{
+			/// The dependencies resolved to construct the type.
+			using Type = std::conditional_t<HasSerumConstructor<T>::value, Dependencies<>, typename DependenciesOf<T>::Type>;
+		};
 	}
 }
 
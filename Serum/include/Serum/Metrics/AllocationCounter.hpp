@@ -0,0 +1,151 @@
+/// @file AllocationCounter.hpp
+/// Defines per-thread counters of heap allocations, and a macro which installs global allocation functions that update them.
+
+#ifndef SERUM_METRICS_ALLOCATION_COUNTER_HPP
+#define SERUM_METRICS_ALLOCATION_COUNTER_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Serum::Metrics
+{
+	/// A number of heap allocations and the bytes they requested.
+	struct AllocationCounts final
+	{
+		/// The number of allocations.
+		std::uint64_t count;
+
+		/// The number of bytes requested by the allocations.
+		std::uint64_t bytes;
+	};
+
+	/// Counts the heap allocations made on each thread. Allocations are only counted once SERUM_INSTALL_ALLOCATION_HOOKS
+	/// has been used in the program; until then, every count is zero.
+	class AllocationCounter final
+	{
+		public:
+			/// Deleted default constructor.
+			AllocationCounter() = delete;
+
+			/// Records an allocation made on the calling thread. Called by the hooks installed with SERUM_INSTALL_ALLOCATION_HOOKS.
+			/// @param bytes The number of bytes requested.
+			static void RecordAllocation(std::size_t const bytes) noexcept
+			{
+				auto& counts = GetThreadCountsReference();
+				++counts.count;
+				counts.bytes += bytes;
+			}
+
+			/// Gets the allocations made on the calling thread since it started.
+			/// @returns The allocation counts.
+			[[nodiscard]] static AllocationCounts GetThreadCounts() noexcept
+			{
+				return GetThreadCountsReference();
+			}
+
+			/// Gets the address of the calling thread's allocation counts. Each thread's counts have a distinct address,
+			/// so it also identifies the thread.
+			/// @returns The address of the allocation counts.
+			[[nodiscard]] static AllocationCounts const* GetThreadCountsAddress() noexcept
+			{
+				return &GetThreadCountsReference();
+			}
+
+			/// Counts an allocation on the calling thread and allocates the memory with std::malloc. Like the default
+			/// operator new, a failed allocation calls the installed std::new_handler and retries. Called by the
+			/// operator new installed with SERUM_INSTALL_ALLOCATION_HOOKS.
+			/// @param bytes The number of bytes requested.
+			/// @returns The allocated memory.
+			/// @throws std::bad_alloc If the memory cannot be allocated and there is no std::new_handler.
+			[[nodiscard]] static SERUM_NOINLINE void* Allocate(std::size_t const bytes)
+			{
+				RecordAllocation(bytes);
+
+				while (true)
+				{
+					if (auto* const memory = std::malloc(bytes == 0 ? 1 : bytes))
+					{
+						return memory;
+					}
+
+					auto const handler = std::get_new_handler();
+					if (handler == nullptr)
+					{
+						throw std::bad_alloc();
+					}
+
+					handler();
+				}
+			}
+
+			/// Frees memory allocated by Allocate. Called by the operator delete installed with SERUM_INSTALL_ALLOCATION_HOOKS.
+			/// @param memory The memory to free.
+			static SERUM_NOINLINE void Deallocate(void* const memory) noexcept
+			{
+				std::free(memory);
+			}
+
+			/// Gets whether the allocation hooks have been installed with SERUM_INSTALL_ALLOCATION_HOOKS.
+			/// @returns True if allocations are being counted, and false otherwise.
+			[[nodiscard]] static bool IsInstalled() noexcept
+			{
+				return GetInstalledFlag().load(std::memory_order_relaxed);
+			}
+
+			/// Records that the allocation hooks have been installed. Called by SERUM_INSTALL_ALLOCATION_HOOKS.
+			/// @returns True.
+			static bool MarkInstalled() noexcept
+			{
+				GetInstalledFlag().store(true, std::memory_order_relaxed);
+
+				return true;
+			}
+
+		private:
+			// The counters are plain thread locals with no destructor, so they can be updated from operator new
+			// at any point in a thread's lifetime, including while thread locals are being destroyed.
+			[[nodiscard]] static AllocationCounts& GetThreadCountsReference() noexcept
+			{
+				static thread_local auto counts = AllocationCounts{ 0, 0 };
+
+				return counts;
+			}
+
+			[[nodiscard]] static std::atomic<bool>& GetInstalledFlag() noexcept
+			{
+				static auto isInstalled = std::atomic<bool>(false);
+
+				return isInstalled;
+			}
+	};
+}
+
+/// Replaces the global operator new and operator delete with versions which count every allocation with
+/// Metrics::AllocationCounter, and allocate with std::malloc. Use at global scope in exactly one translation unit
+/// of a test or profiling build. Combined with SERUM_ENABLE_METRICS, the allocations made while each binding resolves
+/// are reported in its BindingStatistics. The default array, nothrow and sized forms forward to these functions, so
+/// they are counted too; over-aligned allocations are not. The hooks call the out-of-line AllocationCounter::Allocate
+/// and AllocationCounter::Deallocate, so compilers do not see std::free paired with operator new.
+#define SERUM_INSTALL_ALLOCATION_HOOKS() \
+	void* operator new(std::size_t size) \
+	{ \
+		return ::Serum::Metrics::AllocationCounter::Allocate(size); \
+	} \
+	void operator delete(void* memory) noexcept \
+	{ \
+		::Serum::Metrics::AllocationCounter::Deallocate(memory); \
+	} \
+	void operator delete(void* memory, std::size_t) noexcept \
+	{ \
+		::Serum::Metrics::AllocationCounter::Deallocate(memory); \
+	} \
+	namespace \
+	{ \
+		[[maybe_unused]] bool const SerumAllocationHooksInstalled = ::Serum::Metrics::AllocationCounter::MarkInstalled(); \
+	} \
+	static_assert(true, "")
+
+#endif // SERUM_METRICS_ALLOCATION_COUNTER_HPP
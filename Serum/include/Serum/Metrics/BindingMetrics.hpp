@@ -0,0 +1,136 @@
+/// @file BindingMetrics.hpp
+/// Defines the live resolution metrics of a binding, which are recorded when Serum is compiled with SERUM_ENABLE_METRICS.
+
+#ifndef SERUM_METRICS_BINDING_METRICS_HPP
+#define SERUM_METRICS_BINDING_METRICS_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Metrics/AllocationCounter.hpp"
+#include "Serum/Metrics/BindingStatistics.hpp"
+#include "Serum/Metrics/LatencyHistogram.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace Serum::Metrics
+{
+	/// The clock used to measure resolutions.
+	using Clock = std::chrono::steady_clock;
+
+	/// Gets the number of nanoseconds that have elapsed since a time point.
+	/// @param start The time point.
+	/// @returns The number of elapsed nanoseconds.
+	[[nodiscard]] inline std::uint64_t GetNanosecondsSince(Clock::time_point const start) noexcept
+	{
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+	}
+
+	/// A resolution in progress in a resolution context. Nested resolutions add their inclusive time and allocations
+	/// to their parent frame, so that what a binding spends resolving its dependencies can be excluded from its own.
+	struct ResolutionFrame final
+	{
+		/// The frame of the resolution which requested this one, or null if this is the outermost resolution.
+		ResolutionFrame* parent;
+
+		/// The total inclusive time of the resolutions nested directly within this one, in nanoseconds.
+		std::uint64_t childNanoseconds;
+
+		/// The total inclusive allocations of the resolutions nested directly within this one on the same thread.
+		AllocationCounts childAllocations;
+
+		/// The allocation counts of the thread the resolution runs on, or null if it may resume on another thread.
+		/// Nested resolutions only add their allocations to a frame which counts the same thread.
+		AllocationCounts const* threadCounts;
+	};
+
+	/// The resolution metrics of a binding. Every counter is updated with relaxed atomic operations, so
+	/// recording is lock-free and bindings can be resolved concurrently. Copies of a binding share its metrics.
+	class BindingMetrics final
+	{
+		public:
+			/// Records a resolution of the binding.
+			/// @param inclusiveNanoseconds The time taken, including resolving dependencies.
+			/// @param exclusiveNanoseconds The time taken, excluding resolving dependencies.
+			/// @param succeeded Whether the resolution returned rather than threw.
+			void RecordResolution(
+				std::uint64_t const inclusiveNanoseconds,
+				std::uint64_t const exclusiveNanoseconds,
+				bool const succeeded) noexcept
+			{
+				resolveCount.fetch_add(1, std::memory_order_relaxed);
+				if (!succeeded)
+				{
+					failureCount.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				totalInclusiveNanoseconds.fetch_add(inclusiveNanoseconds, std::memory_order_relaxed);
+				totalExclusiveNanoseconds.fetch_add(exclusiveNanoseconds, std::memory_order_relaxed);
+				latencyBuckets[LatencyHistogram::GetBucketIndex(inclusiveNanoseconds)].fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/// Records the heap allocations made by a resolution of the binding.
+			/// @param allocations The allocations made, excluding resolving dependencies.
+			void RecordAllocations(AllocationCounts const allocations) noexcept
+			{
+				allocationCount.fetch_add(allocations.count, std::memory_order_relaxed);
+				allocatedBytes.fetch_add(allocations.bytes, std::memory_order_relaxed);
+			}
+
+			/// Records that a singleton binding constructed its instance.
+			/// @param nanoseconds The time taken to construct the instance.
+			void RecordSingletonConstruction(std::uint64_t const nanoseconds) noexcept
+			{
+				singletonConstructionNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+			}
+
+			/// Records that a singleton binding returned its existing instance.
+			void RecordSingletonHit() noexcept
+			{
+				singletonHitCount.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/// Takes a snapshot of the metrics. Counters updated concurrently with the snapshot may be
+			/// slightly inconsistent with one another.
+			/// @param key The key of the binding.
+			/// @param bindingType The type of the binding.
+			/// @returns The snapshot.
+			[[nodiscard]] BindingStatistics GetStatistics(
+				Bindings::BindingKey const& key,
+				Bindings::BindingType const bindingType) const
+			{
+				auto bucketCounts = std::array<std::uint64_t, LatencyHistogram::BucketCount>();
+				for (auto bucketIndex = std::size_t(0); bucketIndex < LatencyHistogram::BucketCount; ++bucketIndex)
+				{
+					bucketCounts[bucketIndex] = latencyBuckets[bucketIndex].load(std::memory_order_relaxed);
+				}
+
+				return BindingStatistics{
+					key,
+					bindingType,
+					resolveCount.load(std::memory_order_relaxed),
+					failureCount.load(std::memory_order_relaxed),
+					std::chrono::nanoseconds(totalInclusiveNanoseconds.load(std::memory_order_relaxed)),
+					std::chrono::nanoseconds(totalExclusiveNanoseconds.load(std::memory_order_relaxed)),
+					std::chrono::nanoseconds(singletonConstructionNanoseconds.load(std::memory_order_relaxed)),
+					singletonHitCount.load(std::memory_order_relaxed),
+					allocationCount.load(std::memory_order_relaxed),
+					allocatedBytes.load(std::memory_order_relaxed),
+					LatencyHistogram(bucketCounts)
+				};
+			}
+
+		private:
+			std::atomic<std::uint64_t> resolveCount{ 0 };
+			std::atomic<std::uint64_t> failureCount{ 0 };
+			std::atomic<std::uint64_t> totalInclusiveNanoseconds{ 0 };
+			std::atomic<std::uint64_t> totalExclusiveNanoseconds{ 0 };
+			std::atomic<std::uint64_t> singletonConstructionNanoseconds{ 0 };
+			std::atomic<std::uint64_t> singletonHitCount{ 0 };
+			std::atomic<std::uint64_t> allocationCount{ 0 };
+			std::atomic<std::uint64_t> allocatedBytes{ 0 };
+			std::array<std::atomic<std::uint64_t>, LatencyHistogram::BucketCount> latencyBuckets{};
+	};
+}
+
+#endif // SERUM_METRICS_BINDING_METRICS_HPP
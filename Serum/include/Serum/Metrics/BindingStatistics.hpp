@@ -0,0 +1,74 @@
+/// @file BindingStatistics.hpp
+/// Defines a snapshot of the resolution metrics recorded for a binding.
+
+#ifndef SERUM_METRICS_BINDING_STATISTICS_HPP
+#define SERUM_METRICS_BINDING_STATISTICS_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/BindingKey.hpp"
+#include "Serum/Bindings/BindingType.hpp"
+#include "Serum/Metrics/LatencyHistogram.hpp"
+
+#include <chrono>
+
+namespace Serum::Metrics
+{
+	/// A snapshot of the resolution metrics recorded for a binding. Durations are measured with
+	/// std::chrono::steady_clock, and include any time an asynchronous resolution spends suspended.
+	struct BindingStatistics final
+	{
+		/// The key of the binding.
+		Bindings::BindingKey key;
+
+		/// The type of the binding.
+		Bindings::BindingType bindingType;
+
+		/// The number of times the binding has been resolved, including resolutions which threw.
+		std::uint64_t resolveCount;
+
+		/// The number of resolutions which threw.
+		std::uint64_t failureCount;
+
+		/// The total time spent resolving the binding, including resolving its dependencies.
+		std::chrono::nanoseconds inclusiveTime;
+
+		/// The total time spent resolving the binding, excluding resolving its dependencies.
+		std::chrono::nanoseconds exclusiveTime;
+
+		/// For singletons, the time taken to construct the instance. Otherwise, zero.
+		std::chrono::nanoseconds singletonConstructionTime;
+
+		/// For singletons, the number of resolutions which returned the existing instance. Otherwise, zero.
+		std::uint64_t singletonHitCount;
+
+		/// The total number of heap allocations made while resolving the binding, excluding resolving its dependencies.
+		/// Allocations are only counted when SERUM_INSTALL_ALLOCATION_HOOKS is used in the program. Otherwise, zero.
+		std::uint64_t allocationCount;
+
+		/// The total number of bytes requested by the allocations counted in allocationCount.
+		std::uint64_t allocatedBytes;
+
+		/// The distribution of the inclusive time of each resolution.
+		LatencyHistogram latency;
+
+		/// Gets the proportion of resolutions of a singleton which returned the existing instance.
+		/// @returns The hit rate, from 0 to 1, or 0 if the binding has not been resolved.
+		[[nodiscard]] double GetSingletonHitRate() const noexcept
+		{
+			return resolveCount == 0
+				? 0.0
+				: static_cast<double>(singletonHitCount) / static_cast<double>(resolveCount);
+		}
+
+		/// Gets the mean number of heap allocations made by each resolution of the binding, excluding its dependencies.
+		/// @returns The mean number of allocations, or 0 if the binding has not been resolved.
+		[[nodiscard]] double GetAllocationsPerResolution() const noexcept
+		{
+			return resolveCount == 0
+				? 0.0
+				: static_cast<double>(allocationCount) / static_cast<double>(resolveCount);
+		}
+	};
+}
+
+#endif // SERUM_METRICS_BINDING_STATISTICS_HPP
@@ -0,0 +1,174 @@
+/// @file LatencyHistogram.hpp
+/// Defines a compact histogram of durations with logarithmically sized buckets.
+
+#ifndef SERUM_METRICS_LATENCY_HISTOGRAM_HPP
+#define SERUM_METRICS_LATENCY_HISTOGRAM_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+#include <array>
+#include <chrono>
+
+namespace Serum::Metrics
+{
+	/// A histogram of durations with logarithmically sized buckets. Durations below SubBucketCount nanoseconds are
+	/// recorded exactly, and every larger power of two is split into SubBucketCount buckets of equal width, so a
+	/// recorded duration is accurate to within 25%. Durations of 2^MaxExponent nanoseconds (around 18 minutes) or
+	/// more are recorded in the last bucket.
+	class LatencyHistogram final
+	{
+		public:
+			/// The number of bits used to select a bucket within a power of two.
+			static constexpr std::size_t SubBucketBits = 2;
+
+			/// The number of buckets each power of two is split into.
+			static constexpr std::size_t SubBucketCount = std::size_t(1) << SubBucketBits;
+
+			/// The exponent of the smallest duration, in nanoseconds, which is recorded in the last bucket.
+			static constexpr std::size_t MaxExponent = 40;
+
+			/// The number of buckets.
+			static constexpr std::size_t BucketCount = (MaxExponent - SubBucketBits + 1) * SubBucketCount;
+
+			/// Initializes a new, empty instance of the LatencyHistogram class.
+			LatencyHistogram() noexcept = default;
+
+			/// Initializes a new instance of the LatencyHistogram class with existing bucket counts.
+			/// @param bucketCounts The number of durations recorded in each bucket.
+			explicit LatencyHistogram(std::array<std::uint64_t, BucketCount> const& bucketCounts) noexcept
+				: bucketCounts(bucketCounts)
+			{
+				for (auto const bucketCount : bucketCounts)
+				{
+					totalCount += bucketCount;
+				}
+			}
+
+			/// Records a duration.
+			/// @param nanoseconds The duration in nanoseconds.
+			void Record(std::uint64_t const nanoseconds) noexcept
+			{
+				++bucketCounts[GetBucketIndex(nanoseconds)];
+				++totalCount;
+			}
+
+			/// Gets the number of recorded durations.
+			/// @returns The number of recorded durations.
+			[[nodiscard]] std::uint64_t GetCount() const noexcept
+			{
+				return totalCount;
+			}
+
+			/// Gets the number of durations recorded in a bucket.
+			/// @param bucketIndex The index of the bucket. Must be less than BucketCount.
+			/// @returns The number of durations recorded in the bucket.
+			[[nodiscard]] std::uint64_t GetBucketCount(std::size_t const bucketIndex) const noexcept
+			{
+				return bucketCounts[bucketIndex];
+			}
+
+			/// Gets the duration at or below which the given percentage of recorded durations lie. The result is the
+			/// largest duration which falls in the same bucket, so it never underestimates the percentile.
+			/// @param percentile The percentile, from 0 to 100.
+			/// @returns The duration, or zero if nothing has been recorded.
+			[[nodiscard]] std::chrono::nanoseconds GetPercentile(double const percentile) const noexcept
+			{
+				if (totalCount == 0)
+				{
+					return std::chrono::nanoseconds(0);
+				}
+
+				auto const clampedPercentile = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+
+				// The nearest rank method: the smallest recorded duration with at least the given percentage
+				// of durations at or below it.
+				auto const exactRank = clampedPercentile / 100.0 * static_cast<double>(totalCount);
+				auto rank = static_cast<std::uint64_t>(exactRank);
+				rank += static_cast<double>(rank) < exactRank || rank == 0 ? 1 : 0;
+
+				auto seen = std::uint64_t(0);
+				for (auto bucketIndex = std::size_t(0); bucketIndex < BucketCount; ++bucketIndex)
+				{
+					seen += bucketCounts[bucketIndex];
+					if (seen >= rank)
+					{
+						return std::chrono::nanoseconds(GetBucketUpperBound(bucketIndex) - 1);
+					}
+				}
+
+				return std::chrono::nanoseconds(GetBucketUpperBound(BucketCount - 1) - 1);
+			}
+
+			/// Gets the index of the bucket a duration is recorded in.
+			/// @param nanoseconds The duration in nanoseconds.
+			/// @returns The index of the bucket.
+			[[nodiscard]] static constexpr std::size_t GetBucketIndex(std::uint64_t const nanoseconds) noexcept
+			{
+				if (nanoseconds < SubBucketCount)
+				{
+					return static_cast<std::size_t>(nanoseconds);
+				}
+
+				auto const exponent = GetMostSignificantBit(nanoseconds);
+				if (exponent >= MaxExponent)
+				{
+					return BucketCount - 1;
+				}
+
+				auto const subBucket = static_cast<std::size_t>(nanoseconds >> (exponent - SubBucketBits)) & (SubBucketCount - 1);
+
+				return (exponent - SubBucketBits + 1) * SubBucketCount + subBucket;
+			}
+
+			/// Gets the smallest duration recorded in a bucket.
+			/// @param bucketIndex The index of the bucket. Must be less than BucketCount.
+			/// @returns The smallest duration recorded in the bucket, in nanoseconds.
+			[[nodiscard]] static constexpr std::uint64_t GetBucketLowerBound(std::size_t const bucketIndex) noexcept
+			{
+				if (bucketIndex < SubBucketCount)
+				{
+					return bucketIndex;
+				}
+
+				auto const powerOfTwo = bucketIndex / SubBucketCount;
+				auto const subBucket = bucketIndex % SubBucketCount;
+
+				return std::uint64_t(SubBucketCount + subBucket) << (powerOfTwo - 1);
+			}
+
+			/// Gets the smallest duration recorded in the bucket after the given one. Durations in the last bucket
+			/// may exceed this.
+			/// @param bucketIndex The index of the bucket. Must be less than BucketCount.
+			/// @returns The exclusive upper bound of the bucket, in nanoseconds.
+			[[nodiscard]] static constexpr std::uint64_t GetBucketUpperBound(std::size_t const bucketIndex) noexcept
+			{
+				if (bucketIndex < SubBucketCount)
+				{
+					return bucketIndex + 1;
+				}
+
+				return GetBucketLowerBound(bucketIndex) + (std::uint64_t(1) << (bucketIndex / SubBucketCount - 1));
+			}
+
+		private:
+			std::array<std::uint64_t, BucketCount> bucketCounts{};
+			std::uint64_t totalCount = 0;
+
+			[[nodiscard]] static constexpr std::size_t GetMostSignificantBit(std::uint64_t const value) noexcept
+			{
+#if defined(__GNUC__) || defined(__clang__)
+				return static_cast<std::size_t>(63 - __builtin_clzll(value));
+#else
+				auto bit = std::size_t(0);
+				for (auto remaining = value >> 1; remaining != 0; remaining >>= 1)
+				{
+					++bit;
+				}
+
+				return bit;
+#endif
+			}
+	};
+}
+
+#endif // SERUM_METRICS_LATENCY_HISTOGRAM_HPP
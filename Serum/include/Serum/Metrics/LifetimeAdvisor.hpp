@@ -0,0 +1,263 @@
+/// @file LifetimeAdvisor.hpp
+/// Defines an analysis of resolution metrics which recommends changes to the lifetimes of bindings.
+
+#ifndef SERUM_METRICS_LIFETIME_ADVISOR_HPP
+#define SERUM_METRICS_LIFETIME_ADVISOR_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/BindingKey.hpp"
+#include "Serum/Bindings/BindingLifetime.hpp"
+#include "Serum/Bindings/BindingType.hpp"
+#include "Serum/DependencyGraph.hpp"
+#include "Serum/Metrics/BindingStatistics.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Serum::Metrics
+{
+	/// The thresholds a binding must meet before the lifetime advisor recommends a change to its lifetime.
+	struct LifetimeAdvisorThresholds final
+	{
+		/// The number of times a transient binding must have been resolved to be promoted.
+		std::uint64_t minimumResolveCount = 1000;
+
+		/// The mean inclusive time at which a resolution of a transient binding is considered expensive.
+		std::chrono::nanoseconds minimumMeanTime = std::chrono::microseconds(1);
+
+		/// The mean number of allocations at which a resolution of a transient binding is considered expensive.
+		double minimumAllocationsPerResolution = 1.0;
+
+		/// The number of times a singleton binding may have been resolved and still be considered rarely used.
+		std::uint64_t maximumSingletonResolveCount = 1;
+
+		/// The number of bytes a singleton must allocate while it is constructed to be considered large.
+		std::uint64_t minimumSingletonBytes = 1024 * 1024;
+	};
+
+	/// A recommended change to the lifetime of a binding. Savings are estimated from the recorded metrics, as if
+	/// the binding had been resolved the same number of times with the recommended lifetime.
+	struct LifetimeRecommendation final
+	{
+		/// The key of the binding.
+		Bindings::BindingKey key;
+
+		/// The type of the binding.
+		Bindings::BindingType bindingType;
+
+		/// The lifetime of the binding.
+		Bindings::BindingLifetime currentLifetime;
+
+		/// The recommended lifetime of the binding.
+		Bindings::BindingLifetime recommendedLifetime;
+
+		/// The estimated resolution time saved. Negative if the recommendation trades time for memory.
+		std::chrono::nanoseconds estimatedTimeSaved;
+
+		/// The estimated number of heap allocations saved. Negative if the recommendation trades allocations for memory.
+		std::int64_t estimatedAllocationsSaved;
+
+		/// The estimated number of bytes which would no longer be held for the lifetime of the container.
+		std::uint64_t estimatedBytesReleased;
+
+		/// Why the change is recommended, and which Bind methods give the recommended lifetime.
+		std::string reason;
+	};
+
+	/// Recommends lifetime changes from the resolution metrics of a container's bindings.
+	///
+	/// A transient binding is recommended to become a singleton when it is resolved often, each resolution is
+	/// expensive, and every dependency it was observed to resolve is itself a singleton or externally owned, so
+	/// each resolution is built from the same inputs. If it instead depends on bindings which are resolved per
+	/// resolution or transiently, but it is resolved more than once per top-level Get, for example because two of
+	/// the bindings in the Get depend on it, it is recommended to be resolved per resolution.
+	///
+	/// A singleton binding is recommended to become transient when it is rarely resolved and large.
+	///
+	/// Dependencies are only known if the container's observer is an Observers::DependencyGraphRecorder, and sizes
+	/// are only known if SERUM_INSTALL_ALLOCATION_HOOKS is used. The advisor only sees what a binding resolves from
+	/// the container, so a recommendation should be checked against any other state the binding reads.
+	/// @param statistics The statistics of each binding, from SerumContainer::GetStatistics.
+	/// @param graph The dependency graph of the same container, from SerumContainer::GetDependencyGraph.
+	/// @param thresholds The thresholds a binding must meet for a change to be recommended.
+	/// @returns The recommendations, ordered by estimated time saved, then by estimated bytes released.
+	[[nodiscard]] inline std::vector<LifetimeRecommendation> AdviseLifetimes(
+		std::vector<BindingStatistics> const& statistics,
+		DependencyGraph const& graph,
+		LifetimeAdvisorThresholds const& thresholds = LifetimeAdvisorThresholds())
+	{
+		auto lifetimes = std::unordered_map<Bindings::BindingKey, Bindings::BindingLifetime>();
+		for (auto const& node : graph.GetNodes())
+		{
+			lifetimes.emplace(node.key, node.lifetime);
+		}
+
+		auto resolveCounts = std::unordered_map<Bindings::BindingKey, std::uint64_t>();
+		for (auto const& binding : statistics)
+		{
+			resolveCounts.emplace(binding.key, binding.resolveCount);
+		}
+
+		// Dependencies which are not nodes, such as bindings in another container, are assumed to be transient.
+		auto transientInputs = std::unordered_set<Bindings::BindingKey>();
+		auto dependents = std::unordered_map<Bindings::BindingKey, std::vector<Bindings::BindingKey>>();
+		auto dependentResolveCounts = std::unordered_map<Bindings::BindingKey, std::uint64_t>();
+		for (auto const& edge : graph.GetEdges())
+		{
+			auto const dependencyLifetime = lifetimes.find(edge.dependency);
+			if (dependencyLifetime == lifetimes.end()
+				|| (dependencyLifetime->second != Bindings::BindingLifetime::Singleton
+					&& dependencyLifetime->second != Bindings::BindingLifetime::External))
+			{
+				transientInputs.insert(edge.dependent);
+			}
+
+			dependents[edge.dependency].push_back(edge.dependent);
+			dependentResolveCounts[edge.dependency] += edge.resolveCount;
+		}
+
+		// A binding's resolutions which were not requested by another binding were top-level Gets. Each Get of the
+		// binding or of a binding which depends on it, directly or not, needs at most one instance of it in a
+		// per-resolution lifetime, so any resolutions beyond that number were repeated within a single Get, such as
+		// a dependency shared by two bindings in a diamond. Returns zero if the ancestors' statistics are unknown.
+		auto const getRedundantResolveCount = [&](Bindings::BindingKey const& key, std::uint64_t const resolveCount)
+		{
+			auto getCount = std::uint64_t(0);
+			auto visited = std::unordered_set<Bindings::BindingKey>{ key };
+			auto pending = std::vector<Bindings::BindingKey>{ key };
+
+			while (!pending.empty())
+			{
+				auto const ancestor = pending.back();
+				pending.pop_back();
+
+				auto const ancestorResolveCount = resolveCounts.find(ancestor);
+				if (ancestorResolveCount == resolveCounts.end())
+				{
+					return std::uint64_t(0);
+				}
+
+				auto const requestedCount = dependentResolveCounts.find(ancestor);
+				auto const requestedResolveCount = requestedCount == dependentResolveCounts.end() ? 0 : requestedCount->second;
+				if (ancestorResolveCount->second > requestedResolveCount)
+				{
+					getCount += ancestorResolveCount->second - requestedResolveCount;
+				}
+
+				auto const ancestorDependents = dependents.find(ancestor);
+				if (ancestorDependents != dependents.end())
+				{
+					for (auto const& dependent : ancestorDependents->second)
+					{
+						if (visited.insert(dependent).second)
+						{
+							pending.push_back(dependent);
+						}
+					}
+				}
+			}
+
+			return resolveCount > getCount ? resolveCount - getCount : 0;
+		};
+
+		auto recommendations = std::vector<LifetimeRecommendation>();
+
+		for (auto const& binding : statistics)
+		{
+			auto const lifetime = Bindings::GetBindingLifetime(binding.bindingType);
+			if (binding.resolveCount == 0 || binding.failureCount != 0)
+			{
+				continue;
+			}
+
+			auto const resolveCount = static_cast<std::int64_t>(binding.resolveCount);
+
+			if (binding.bindingType == Bindings::BindingType::Singleton)
+			{
+				if (binding.resolveCount <= thresholds.maximumSingletonResolveCount
+					&& binding.allocatedBytes >= thresholds.minimumSingletonBytes)
+				{
+					// Each resolution which returned the existing instance would construct a new one instead.
+					auto const hitCount = static_cast<std::int64_t>(binding.singletonHitCount);
+
+					recommendations.push_back(LifetimeRecommendation{
+						binding.key,
+						binding.bindingType,
+						lifetime,
+						Bindings::BindingLifetime::Transient,
+						-binding.singletonConstructionTime * hitCount,
+						-static_cast<std::int64_t>(binding.allocationCount) * hitCount,
+						binding.allocatedBytes,
+						"Resolved " + std::to_string(binding.resolveCount) + " times, but holds "
+							+ std::to_string(binding.allocatedBytes) + " bytes; bind with BindSharedPointer, BindRawPointer or BindToSelf"
+					});
+				}
+
+				continue;
+			}
+
+			auto const meanTime = binding.inclusiveTime / resolveCount;
+			if (lifetime != Bindings::BindingLifetime::Transient
+				|| binding.resolveCount < thresholds.minimumResolveCount
+				|| (meanTime < thresholds.minimumMeanTime
+					&& binding.GetAllocationsPerResolution() < thresholds.minimumAllocationsPerResolution))
+			{
+				continue;
+			}
+
+			auto const hasSingletonInputs = transientInputs.find(binding.key) == transientInputs.end();
+			auto const redundantResolveCount = hasSingletonInputs ? 0 : getRedundantResolveCount(binding.key, binding.resolveCount);
+
+			auto const allocationsPerResolution = binding.GetAllocationsPerResolution();
+			auto const describeCost = "Resolved " + std::to_string(binding.resolveCount) + " times at a mean of "
+				+ std::to_string(meanTime.count()) + "ns, making " + std::to_string(binding.allocationCount) + " allocations";
+
+			if (hasSingletonInputs)
+			{
+				// A singleton would be constructed once rather than on every resolution.
+				auto const savedResolveCount = resolveCount - 1;
+
+				recommendations.push_back(LifetimeRecommendation{
+					binding.key,
+					binding.bindingType,
+					lifetime,
+					Bindings::BindingLifetime::Singleton,
+					meanTime * savedResolveCount,
+					static_cast<std::int64_t>(allocationsPerResolution * static_cast<double>(savedResolveCount)),
+					0,
+					describeCost + " from singleton dependencies; bind with BindSingletonSharedPointer or BindSingletonRawPointer"
+				});
+			}
+			else if (redundantResolveCount > 0)
+			{
+				auto const savedResolveCount = static_cast<std::int64_t>(redundantResolveCount);
+
+				recommendations.push_back(LifetimeRecommendation{
+					binding.key,
+					binding.bindingType,
+					lifetime,
+					Bindings::BindingLifetime::PerResolution,
+					meanTime * savedResolveCount,
+					static_cast<std::int64_t>(allocationsPerResolution * static_cast<double>(savedResolveCount)),
+					0,
+					describeCost + ", " + std::to_string(redundantResolveCount)
+						+ " of them repeated within a resolution; bind with BindPerResolutionSharedPointer or BindPerResolutionToSelf"
+				});
+			}
+		}
+
+		std::sort(recommendations.begin(), recommendations.end(), [](auto const& left, auto const& right)
+		{
+			return left.estimatedTimeSaved != right.estimatedTimeSaved
+				? left.estimatedTimeSaved > right.estimatedTimeSaved
+				: left.estimatedBytesReleased > right.estimatedBytesReleased;
+		});
+
+		return recommendations;
+	}
+}
+
+#endif // SERUM_METRICS_LIFETIME_ADVISOR_HPP
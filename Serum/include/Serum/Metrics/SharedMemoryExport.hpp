@@ -0,0 +1,471 @@
+/// @file SharedMemoryExport.hpp
+/// Defines the layout of binding statistics exported to POSIX shared memory, and the types which write and read it.
+
+#ifndef SERUM_METRICS_SHARED_MEMORY_EXPORT_HPP
+#define SERUM_METRICS_SHARED_MEMORY_EXPORT_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/SharedMemoryMapping.hpp"
+#include "Serum/Metrics/BindingStatistics.hpp"
+#include "Serum/Metrics/LatencyHistogram.hpp"
+
+#ifdef SERUM_HAS_SHARED_MEMORY
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace Serum::Metrics
+{
+	/// The version of the shared memory layout written by this version of Serum. Readers must reject other versions.
+	inline constexpr std::uint32_t SharedMemoryLayoutVersion = 1;
+
+	/// The first eight bytes of a shared memory region, "SERUMSHM", read as a little-endian integer.
+	inline constexpr std::uint64_t SharedMemoryMagic = 0x4D48534D55524553;
+
+	/// The maximum number of bytes of a binding key stored in a record, including the terminating null character.
+	inline constexpr std::size_t SharedMemoryKeyLength = 128;
+
+	/// The header at the start of a shared memory region. Every field is written in the byte order of the writer.
+	/// Version 1 of the layout is:
+	///
+	/// | Offset | Size | Field |
+	/// | --- | --- | --- |
+	/// | 0 | 8 | magic, "SERUMSHM", written last when the region is created |
+	/// | 8 | 4 | version |
+	/// | 12 | 4 | headerSize, the offset of the first record |
+	/// | 16 | 4 | recordSize, the distance between records |
+	/// | 20 | 4 | capacity, the number of records the region can hold |
+	/// | 24 | 4 | bucketCount, the number of latency buckets in each record |
+	/// | 28 | 4 | recordCount, the number of records which have been published |
+	/// | 32 | 8 | publishCount, the number of times the statistics have been published |
+	/// | 40 | 8 | lastPublishTime, in nanoseconds since the Unix epoch |
+	/// | 48 | 8 | writerProcessId |
+	/// | 56 | 8 | droppedCount, the number of bindings which did not fit in the region at the last publish |
+	struct SharedMemoryHeader final
+	{
+		/// The magic number identifying the region.
+		std::atomic<std::uint64_t> magic;
+
+		/// The version of the layout.
+		std::uint32_t version;
+
+		/// The offset of the first record.
+		std::uint32_t headerSize;
+
+		/// The distance between records.
+		std::uint32_t recordSize;
+
+		/// The number of records the region can hold.
+		std::uint32_t capacity;
+
+		/// The number of latency buckets in each record.
+		std::uint32_t bucketCount;
+
+		/// The number of records which have been published. Records are never removed, and keep their index.
+		std::atomic<std::uint32_t> recordCount;
+
+		/// The number of times the statistics have been published.
+		std::atomic<std::uint64_t> publishCount;
+
+		/// The time the statistics were last published, in nanoseconds since the Unix epoch.
+		std::atomic<std::uint64_t> lastPublishTime;
+
+		/// The identifier of the process which writes the region.
+		std::uint64_t writerProcessId;
+
+		/// The number of bindings which did not fit in the region at the last publish.
+		std::atomic<std::uint64_t> droppedCount;
+	};
+
+	/// The statistics of one binding in a shared memory region. Records follow the header, recordSize bytes apart.
+	/// Each record is protected by a sequence lock: the sequence is odd while the record is being written, so a
+	/// reader copies the record, and retries if the sequence was odd or changed while it was copying. Version 1 of
+	/// the layout is:
+	///
+	/// | Offset | Size | Field |
+	/// | --- | --- | --- |
+	/// | 0 | 8 | sequence |
+	/// | 8 | 128 | key, the binding key as text, null terminated and truncated to fit |
+	/// | 136 | 8 | bindingType, the value of the BindingType |
+	/// | 144 | 8 | resolveCount |
+	/// | 152 | 8 | failureCount |
+	/// | 160 | 8 | inclusiveNanoseconds |
+	/// | 168 | 8 | exclusiveNanoseconds |
+	/// | 176 | 8 | singletonConstructionNanoseconds |
+	/// | 184 | 8 | singletonHitCount |
+	/// | 192 | 8 | allocationCount |
+	/// | 200 | 8 | allocatedBytes |
+	/// | 208 | 8 × bucketCount | latencyBuckets, the counts of the LatencyHistogram buckets |
+	struct alignas(64) SharedMemoryRecord final
+	{
+		/// The sequence number of the record, which is odd while the record is being written.
+		std::atomic<std::uint64_t> sequence;
+
+		/// The binding key as text, in words so that it can be copied atomically.
+		std::array<std::atomic<std::uint64_t>, SharedMemoryKeyLength / sizeof(std::uint64_t)> key;
+
+		/// The value of the binding's BindingType.
+		std::atomic<std::uint64_t> bindingType;
+
+		/// The number of times the binding has been resolved.
+		std::atomic<std::uint64_t> resolveCount;
+
+		/// The number of resolutions which threw.
+		std::atomic<std::uint64_t> failureCount;
+
+		/// The total time spent resolving the binding, including its dependencies.
+		std::atomic<std::uint64_t> inclusiveNanoseconds;
+
+		/// The total time spent resolving the binding, excluding its dependencies.
+		std::atomic<std::uint64_t> exclusiveNanoseconds;
+
+		/// For singletons, the time taken to construct the instance.
+		std::atomic<std::uint64_t> singletonConstructionNanoseconds;
+
+		/// For singletons, the number of resolutions which returned the existing instance.
+		std::atomic<std::uint64_t> singletonHitCount;
+
+		/// The number of heap allocations made while resolving the binding, excluding its dependencies.
+		std::atomic<std::uint64_t> allocationCount;
+
+		/// The number of bytes requested by the allocations.
+		std::atomic<std::uint64_t> allocatedBytes;
+
+		/// The counts of the buckets of the binding's LatencyHistogram.
+		std::array<std::atomic<std::uint64_t>, LatencyHistogram::BucketCount> latencyBuckets;
+	};
+
+	// The layout is read by other processes, which may not be built with Serum, so it must not change by accident.
+	static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Shared memory statistics need lock-free 64-bit atomics.");
+	static_assert(sizeof(SharedMemoryHeader) == 64, "The shared memory header layout has changed.");
+	static_assert(offsetof(SharedMemoryHeader, recordCount) == 28, "The shared memory header layout has changed.");
+	static_assert(offsetof(SharedMemoryHeader, droppedCount) == 56, "The shared memory header layout has changed.");
+	static_assert(offsetof(SharedMemoryRecord, bindingType) == 136, "The shared memory record layout has changed.");
+	static_assert(offsetof(SharedMemoryRecord, latencyBuckets) == 208, "The shared memory record layout has changed.");
+
+	/// The statistics of a binding, as read from a shared memory region by a SharedMemoryReader.
+	struct ExportedBindingStatistics final
+	{
+		/// The binding key as text, as returned by BindingKey::ToString.
+		std::string key;
+
+		/// The type of the binding.
+		Bindings::BindingType bindingType;
+
+		/// The number of times the binding has been resolved, including resolutions which threw.
+		std::uint64_t resolveCount;
+
+		/// The number of resolutions which threw.
+		std::uint64_t failureCount;
+
+		/// The total time spent resolving the binding, including resolving its dependencies.
+		std::chrono::nanoseconds inclusiveTime;
+
+		/// The total time spent resolving the binding, excluding resolving its dependencies.
+		std::chrono::nanoseconds exclusiveTime;
+
+		/// For singletons, the time taken to construct the instance. Otherwise, zero.
+		std::chrono::nanoseconds singletonConstructionTime;
+
+		/// For singletons, the number of resolutions which returned the existing instance. Otherwise, zero.
+		std::uint64_t singletonHitCount;
+
+		/// The total number of heap allocations made while resolving the binding, excluding resolving its dependencies.
+		std::uint64_t allocationCount;
+
+		/// The total number of bytes requested by the allocations counted in allocationCount.
+		std::uint64_t allocatedBytes;
+
+		/// The distribution of the inclusive time of each resolution.
+		LatencyHistogram latency;
+	};
+
+	/// Publishes snapshots of binding statistics to a POSIX shared memory object, such as /dev/shm/name on Linux, in the
+	/// versioned layout described by SharedMemoryHeader and SharedMemoryRecord, so that other processes can sample them
+	/// without calling into this one. Each binding keeps the same record across publishes. The object is removed when
+	/// the exporter is destroyed.
+	class SharedMemoryExporter final
+	{
+		public:
+			/// Creates the shared memory object, replacing any existing object with the same name.
+			/// @param name The name of the object, starting with a slash, such as "/my-service-serum".
+			/// @param capacity The number of bindings the object can hold. Bindings beyond it are not published.
+			/// @throws SerumException If the object cannot be created.
+			explicit SharedMemoryExporter(std::string const& name, std::size_t const capacity = 256)
+				: mapping(Internal::SharedMemoryMapping::Create(name, sizeof(SharedMemoryHeader) + capacity * sizeof(SharedMemoryRecord))),
+				  capacity(capacity)
+			{
+				auto* const header = new (mapping.GetAddress()) SharedMemoryHeader{};
+				header->version = SharedMemoryLayoutVersion;
+				header->headerSize = static_cast<std::uint32_t>(sizeof(SharedMemoryHeader));
+				header->recordSize = static_cast<std::uint32_t>(sizeof(SharedMemoryRecord));
+				header->capacity = static_cast<std::uint32_t>(capacity);
+				header->bucketCount = static_cast<std::uint32_t>(LatencyHistogram::BucketCount);
+				header->writerProcessId = static_cast<std::uint64_t>(::getpid());
+
+				for (auto index = std::size_t(0); index < capacity; ++index)
+				{
+					new (GetRecords() + index) SharedMemoryRecord{};
+				}
+
+				header->magic.store(SharedMemoryMagic, std::memory_order_release);
+			}
+
+			/// Deleted copy constructor.
+			SharedMemoryExporter(SharedMemoryExporter const&) = delete;
+
+			/// Deleted copy assignment operator.
+			SharedMemoryExporter& operator=(SharedMemoryExporter const&) = delete;
+
+			/// Gets the number of bindings the shared memory object can hold.
+			/// @returns The capacity.
+			[[nodiscard]] std::size_t GetCapacity() const noexcept
+			{
+				return capacity;
+			}
+
+			/// Publishes a snapshot of binding statistics, such as the result of SerumContainer::GetStatistics.
+			/// Readers never see a partially written record. Publishing from several threads is serialized.
+			/// @param statistics The statistics to publish.
+			void Publish(std::vector<BindingStatistics> const& statistics)
+			{
+				auto const lock = std::lock_guard(mutex);
+				auto& header = GetHeader();
+				auto dropped = std::uint64_t(0);
+
+				for (auto const& bindingStatistics : statistics)
+				{
+					auto key = bindingStatistics.key.ToString();
+					auto iterator = recordIndices.find(key);
+
+					if (iterator == recordIndices.end())
+					{
+						if (recordIndices.size() == capacity)
+						{
+							++dropped;
+							continue;
+						}
+
+						iterator = recordIndices.emplace(std::move(key), recordIndices.size()).first;
+					}
+
+					WriteRecord(GetRecords()[iterator->second], iterator->first, bindingStatistics);
+				}
+
+				auto const now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch());
+
+				header.droppedCount.store(dropped, std::memory_order_relaxed);
+				header.lastPublishTime.store(static_cast<std::uint64_t>(now.count()), std::memory_order_relaxed);
+				header.recordCount.store(static_cast<std::uint32_t>(recordIndices.size()), std::memory_order_release);
+				header.publishCount.fetch_add(1, std::memory_order_release);
+			}
+
+		private:
+			Internal::SharedMemoryMapping mapping;
+			std::size_t capacity;
+			std::mutex mutex{};
+			std::unordered_map<std::string, std::size_t> recordIndices{};
+
+			[[nodiscard]] SharedMemoryHeader& GetHeader() const noexcept
+			{
+				return *static_cast<SharedMemoryHeader*>(mapping.GetAddress());
+			}
+
+			[[nodiscard]] SharedMemoryRecord* GetRecords() const noexcept
+			{
+				return reinterpret_cast<SharedMemoryRecord*>(static_cast<char*>(mapping.GetAddress()) + sizeof(SharedMemoryHeader));
+			}
+
+			static void WriteRecord(SharedMemoryRecord& record, std::string const& key, BindingStatistics const& statistics) noexcept
+			{
+				auto keyWords = std::array<std::uint64_t, SharedMemoryKeyLength / sizeof(std::uint64_t)>{};
+				std::memcpy(keyWords.data(), key.data(), std::min(key.size(), SharedMemoryKeyLength - 1));
+
+				auto const sequence = record.sequence.load(std::memory_order_relaxed);
+				record.sequence.store(sequence + 1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+
+				for (auto word = std::size_t(0); word < keyWords.size(); ++word)
+				{
+					record.key[word].store(keyWords[word], std::memory_order_relaxed);
+				}
+
+				record.bindingType.store(static_cast<std::uint64_t>(statistics.bindingType), std::memory_order_relaxed);
+				record.resolveCount.store(statistics.resolveCount, std::memory_order_relaxed);
+				record.failureCount.store(statistics.failureCount, std::memory_order_relaxed);
+				record.inclusiveNanoseconds.store(static_cast<std::uint64_t>(statistics.inclusiveTime.count()), std::memory_order_relaxed);
+				record.exclusiveNanoseconds.store(static_cast<std::uint64_t>(statistics.exclusiveTime.count()), std::memory_order_relaxed);
+				record.singletonConstructionNanoseconds.store(
+					static_cast<std::uint64_t>(statistics.singletonConstructionTime.count()),
+					std::memory_order_relaxed);
+				record.singletonHitCount.store(statistics.singletonHitCount, std::memory_order_relaxed);
+				record.allocationCount.store(statistics.allocationCount, std::memory_order_relaxed);
+				record.allocatedBytes.store(statistics.allocatedBytes, std::memory_order_relaxed);
+
+				for (auto bucketIndex = std::size_t(0); bucketIndex < LatencyHistogram::BucketCount; ++bucketIndex)
+				{
+					record.latencyBuckets[bucketIndex].store(statistics.latency.GetBucketCount(bucketIndex), std::memory_order_relaxed);
+				}
+
+				record.sequence.store(sequence + 2, std::memory_order_release);
+			}
+	};
+
+	/// Reads the binding statistics published to a shared memory object by a SharedMemoryExporter, possibly in another
+	/// process. Reading never blocks the writer.
+	class SharedMemoryReader final
+	{
+		public:
+			/// Opens a shared memory object written by a SharedMemoryExporter.
+			/// @param name The name the exporter was created with.
+			/// @throws SerumException If the object does not exist, or was not written by a compatible version of Serum.
+			explicit SharedMemoryReader(std::string const& name)
+				: mapping(Internal::SharedMemoryMapping::Open(name))
+			{
+				if (mapping.GetSize() < sizeof(SharedMemoryHeader)
+					|| GetHeader().magic.load(std::memory_order_acquire) != SharedMemoryMagic)
+				{
+					throw SerumException("Shared memory object " + name + " does not contain Serum statistics.");
+				}
+
+				auto const& header = GetHeader();
+				if (header.version != SharedMemoryLayoutVersion
+					|| header.headerSize != sizeof(SharedMemoryHeader)
+					|| header.recordSize != sizeof(SharedMemoryRecord)
+					|| header.bucketCount != LatencyHistogram::BucketCount
+					|| mapping.GetSize() < sizeof(SharedMemoryHeader) + std::size_t(header.capacity) * sizeof(SharedMemoryRecord))
+				{
+					throw SerumException(
+						"Shared memory object " + name + " has layout version " + std::to_string(header.version)
+						+ ", but version " + std::to_string(SharedMemoryLayoutVersion) + " was expected.");
+				}
+			}
+
+			/// Gets the number of times the statistics have been published.
+			/// @returns The number of publishes.
+			[[nodiscard]] std::uint64_t GetPublishCount() const noexcept
+			{
+				return GetHeader().publishCount.load(std::memory_order_acquire);
+			}
+
+			/// Gets the identifier of the process which writes the statistics.
+			/// @returns The process identifier.
+			[[nodiscard]] std::uint64_t GetWriterProcessId() const noexcept
+			{
+				return GetHeader().writerProcessId;
+			}
+
+			/// Gets the number of bindings which did not fit in the shared memory object when the statistics were last published.
+			/// @returns The number of bindings which were not published.
+			[[nodiscard]] std::uint64_t GetDroppedCount() const noexcept
+			{
+				return GetHeader().droppedCount.load(std::memory_order_relaxed);
+			}
+
+			/// Reads the statistics of every published binding. Records which are being written are retried, and
+			/// skipped if they are still being written after several attempts.
+			/// @returns The statistics, in the order the bindings were first published.
+			[[nodiscard]] std::vector<ExportedBindingStatistics> Read() const
+			{
+				auto const& header = GetHeader();
+				auto const recordCount = std::min(header.recordCount.load(std::memory_order_acquire), header.capacity);
+				auto const* const records = reinterpret_cast<SharedMemoryRecord const*>(
+					static_cast<char const*>(mapping.GetAddress()) + sizeof(SharedMemoryHeader));
+
+				auto statistics = std::vector<ExportedBindingStatistics>();
+				statistics.reserve(recordCount);
+
+				for (auto index = std::uint32_t(0); index < recordCount; ++index)
+				{
+					for (auto attempt = 0; attempt < MaxReadAttempts; ++attempt)
+					{
+						if (TryReadRecord(records[index], statistics))
+						{
+							break;
+						}
+					}
+				}
+
+				return statistics;
+			}
+
+		private:
+			static constexpr int MaxReadAttempts = 64;
+
+			Internal::SharedMemoryMapping mapping;
+
+			[[nodiscard]] SharedMemoryHeader const& GetHeader() const noexcept
+			{
+				return *static_cast<SharedMemoryHeader const*>(mapping.GetAddress());
+			}
+
+			static bool TryReadRecord(SharedMemoryRecord const& record, std::vector<ExportedBindingStatistics>& statistics)
+			{
+				auto const sequence = record.sequence.load(std::memory_order_acquire);
+				if (sequence % 2 != 0)
+				{
+					return false;
+				}
+
+				auto keyWords = std::array<std::uint64_t, SharedMemoryKeyLength / sizeof(std::uint64_t)>{};
+				for (auto word = std::size_t(0); word < keyWords.size(); ++word)
+				{
+					keyWords[word] = record.key[word].load(std::memory_order_relaxed);
+				}
+
+				auto bucketCounts = std::array<std::uint64_t, LatencyHistogram::BucketCount>{};
+				for (auto bucketIndex = std::size_t(0); bucketIndex < LatencyHistogram::BucketCount; ++bucketIndex)
+				{
+					bucketCounts[bucketIndex] = record.latencyBuckets[bucketIndex].load(std::memory_order_relaxed);
+				}
+
+				auto const bindingType = record.bindingType.load(std::memory_order_relaxed);
+				auto const resolveCount = record.resolveCount.load(std::memory_order_relaxed);
+				auto const failureCount = record.failureCount.load(std::memory_order_relaxed);
+				auto const inclusiveNanoseconds = record.inclusiveNanoseconds.load(std::memory_order_relaxed);
+				auto const exclusiveNanoseconds = record.exclusiveNanoseconds.load(std::memory_order_relaxed);
+				auto const singletonConstructionNanoseconds = record.singletonConstructionNanoseconds.load(std::memory_order_relaxed);
+				auto const singletonHitCount = record.singletonHitCount.load(std::memory_order_relaxed);
+				auto const allocationCount = record.allocationCount.load(std::memory_order_relaxed);
+				auto const allocatedBytes = record.allocatedBytes.load(std::memory_order_relaxed);
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (record.sequence.load(std::memory_order_relaxed) != sequence)
+				{
+					return false;
+				}
+
+				auto key = std::string(SharedMemoryKeyLength, '\0');
+				std::memcpy(key.data(), keyWords.data(), SharedMemoryKeyLength);
+				key.resize(std::strlen(key.c_str()));
+
+				statistics.push_back(ExportedBindingStatistics{
+					std::move(key),
+					static_cast<Bindings::BindingType>(bindingType),
+					resolveCount,
+					failureCount,
+					std::chrono::nanoseconds(inclusiveNanoseconds),
+					std::chrono::nanoseconds(exclusiveNanoseconds),
+					std::chrono::nanoseconds(singletonConstructionNanoseconds),
+					singletonHitCount,
+					allocationCount,
+					allocatedBytes,
+					LatencyHistogram(bucketCounts)
+				});
+
+				return true;
+			}
+	};
+}
+
+#endif // SERUM_HAS_SHARED_MEMORY
+
+#endif // SERUM_METRICS_SHARED_MEMORY_EXPORT_HPP
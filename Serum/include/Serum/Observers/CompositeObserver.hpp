@@ -0,0 +1,82 @@
+/// @file CompositeObserver.hpp
+/// Defines an observer which forwards every event to several other observers.
+
+#ifndef SERUM_OBSERVERS_COMPOSITE_OBSERVER_HPP
+#define SERUM_OBSERVERS_COMPOSITE_OBSERVER_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/SerumObserver.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <vector>
+
+namespace Serum::Observers
+{
+	/// Forwards every event to several observers, in the order they were added, so that more than
+	/// one observer can be attached to a container.
+	class CompositeObserver final : public SerumObserver
+	{
+		public:
+			/// Initializes a new instance of the CompositeObserver class.
+			/// @param observers The observers to forward events to. Null observers are ignored.
+			explicit CompositeObserver(std::vector<std::shared_ptr<SerumObserver>> observers = {})
+			{
+				for (auto& observer : observers)
+				{
+					Add(std::move(observer));
+				}
+			}
+
+			/// Adds an observer. This must not be called while the composite is attached to a resolution in progress.
+			/// @param observer The observer. Null observers are ignored.
+			/// @returns The composite observer.
+			CompositeObserver& Add(std::shared_ptr<SerumObserver> observer)
+			{
+				if (observer != nullptr)
+				{
+					observers.push_back(std::move(observer));
+				}
+
+				return *this;
+			}
+
+			/// Gets the number of observers events are forwarded to.
+			/// @returns The number of observers.
+			[[nodiscard]] std::size_t GetNumberOfObservers() const noexcept
+			{
+				return observers.size();
+			}
+
+			void OnResolveBegin(Bindings::BindingKey const& key, std::size_t const depth) override
+			{
+				for (auto const& observer : observers)
+				{
+					observer->OnResolveBegin(key, depth);
+				}
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds const duration, bool const succeeded) override
+			{
+				for (auto const& observer : observers)
+				{
+					observer->OnResolveEnd(key, duration, succeeded);
+				}
+			}
+
+			void OnSingletonCreated(Bindings::BindingKey const& key, std::chrono::nanoseconds const duration) override
+			{
+				for (auto const& observer : observers)
+				{
+					observer->OnSingletonCreated(key, duration);
+				}
+			}
+
+		private:
+			std::vector<std::shared_ptr<SerumObserver>> observers{};
+	};
+}
+
+#endif // SERUM_HAS_OBSERVERS
+
+#endif // SERUM_OBSERVERS_COMPOSITE_OBSERVER_HPP
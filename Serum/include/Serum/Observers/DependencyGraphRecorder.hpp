@@ -0,0 +1,174 @@
+/// @file DependencyGraphRecorder.hpp
+/// Defines an observer which records the dependencies resolved between bindings.
+
+#ifndef SERUM_OBSERVERS_DEPENDENCY_GRAPH_RECORDER_HPP
+#define SERUM_OBSERVERS_DEPENDENCY_GRAPH_RECORDER_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/PerThread.hpp"
+#include "Serum/DependencyGraph.hpp"
+#include "Serum/SerumObserver.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <unordered_map>
+#include <vector>
+
+namespace Serum::Observers
+{
+	/// Records which bindings each binding resolves while it is being resolved, with the number of times and the cumulative
+	/// time taken. Attach it to a container and pass it to SerumContainer::GetDependencyGraph or ExportDependencyGraph to
+	/// add the observed dependencies to the graph. Each thread records into its own table, and the tables are merged on demand.
+	class DependencyGraphRecorder final : public SerumObserver
+	{
+		public:
+			/// Initializes a new instance of the DependencyGraphRecorder class.
+			DependencyGraphRecorder() = default;
+
+			/// Deleted copy constructor.
+			DependencyGraphRecorder(DependencyGraphRecorder const&) = delete;
+
+			/// Deleted copy assignment operator.
+			DependencyGraphRecorder& operator=(DependencyGraphRecorder const&) = delete;
+
+			void OnResolveBegin(Bindings::BindingKey const& key, std::size_t const depth) override
+			{
+				auto& slot = tables.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+
+				// Observers must not throw, so anything which cannot be stored is dropped.
+				try
+				{
+					slot.state.openResolutions.push_back(OpenResolution{ key, depth });
+				}
+				catch (...)
+				{
+				}
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds const duration, bool const succeeded) override
+			{
+				(void)key;
+				(void)succeeded;
+
+				auto& slot = tables.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+				auto& table = slot.state;
+
+				if (table.openResolutions.empty())
+				{
+					return;
+				}
+
+				auto const resolution = std::move(table.openResolutions.back());
+				table.openResolutions.pop_back();
+
+				// A resolution at depth 0 started a new resolution context, so it is not a dependency of whatever
+				// was being resolved on the thread. Bindings which wrap another binding with the same key, such as
+				// singletons, are not dependencies of themselves.
+				if (resolution.depth == 0 || table.openResolutions.empty())
+				{
+					return;
+				}
+
+				auto const& dependent = table.openResolutions.back().key;
+				if (dependent == resolution.key)
+				{
+					return;
+				}
+
+				try
+				{
+					auto& totals = table.edges[EdgeKey{ dependent, resolution.key }];
+					++totals.resolveCount;
+					totals.totalTime += duration;
+				}
+				catch (...)
+				{
+				}
+			}
+
+			/// Gets the dependencies recorded so far on every thread.
+			/// @returns The dependencies, in no particular order.
+			[[nodiscard]] std::vector<DependencyGraphEdge> GetEdges() const
+			{
+				auto merged = EdgeTable();
+				tables.ForEach([&merged](auto const& slot)
+				{
+					for (auto const& [edge, totals] : slot.state.edges)
+					{
+						auto& mergedTotals = merged[edge];
+						mergedTotals.resolveCount += totals.resolveCount;
+						mergedTotals.totalTime += totals.totalTime;
+					}
+				});
+
+				auto edges = std::vector<DependencyGraphEdge>();
+				edges.reserve(merged.size());
+
+				for (auto const& [edge, totals] : merged)
+				{
+					edges.push_back(DependencyGraphEdge{ edge.dependent, edge.dependency, totals.resolveCount, totals.totalTime });
+				}
+
+				return edges;
+			}
+
+			/// Discards the dependencies recorded so far.
+			void Clear()
+			{
+				tables.ForEach([](auto& slot)
+				{
+					slot.state.edges.clear();
+				});
+			}
+
+		private:
+			struct OpenResolution final
+			{
+				Bindings::BindingKey key;
+				std::size_t depth;
+			};
+
+			struct EdgeKey final
+			{
+				Bindings::BindingKey dependent;
+				Bindings::BindingKey dependency;
+
+				bool operator==(EdgeKey const& other) const noexcept
+				{
+					return dependent == other.dependent && dependency == other.dependency;
+				}
+			};
+
+			struct EdgeKeyHash final
+			{
+				std::size_t operator()(EdgeKey const& edge) const noexcept
+				{
+					auto const hash = std::hash<Bindings::BindingKey>();
+
+					return hash(edge.dependent) * 31 + hash(edge.dependency);
+				}
+			};
+
+			struct EdgeTotals final
+			{
+				std::uint64_t resolveCount = 0;
+				std::chrono::nanoseconds totalTime{ 0 };
+			};
+
+			using EdgeTable = std::unordered_map<EdgeKey, EdgeTotals, EdgeKeyHash>;
+
+			struct ThreadTable final
+			{
+				std::vector<OpenResolution> openResolutions{};
+				EdgeTable edges{};
+			};
+
+			Internal::PerThread<ThreadTable> tables{};
+	};
+}
+
+#endif // SERUM_HAS_OBSERVERS
+
+#endif // SERUM_OBSERVERS_DEPENDENCY_GRAPH_RECORDER_HPP
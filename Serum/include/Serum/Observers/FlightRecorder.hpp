@@ -0,0 +1,386 @@
+/// @file FlightRecorder.hpp
+/// Defines an observer which keeps the most recent resolution events of each thread for post-mortem analysis.
+
+#ifndef SERUM_OBSERVERS_FLIGHT_RECORDER_HPP
+#define SERUM_OBSERVERS_FLIGHT_RECORDER_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/PerThread.hpp"
+#include "Serum/SerumObserver.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <typeindex>
+#include <vector>
+
+namespace Serum::Observers
+{
+	/// The kinds of event kept by a FlightRecorder.
+	enum class FlightRecordType
+	{
+		/// A binding started resolving.
+		Begin,
+
+		/// A binding finished resolving.
+		End
+	};
+
+	/// A resolution event kept by a FlightRecorder.
+	struct FlightRecord final
+	{
+		/// The key of the binding. Names longer than FlightRecorder::MaxNameLength are truncated.
+		Bindings::BindingKey key;
+
+		/// The kind of event.
+		FlightRecordType type;
+
+		/// The index of the thread the event was recorded on, starting from 1 in the order threads first recorded an event.
+		std::size_t threadIndex;
+
+		/// The position of the event among every event recorded on its thread, starting from 0.
+		std::uint64_t sequence;
+
+		/// The number of observed resolutions in progress in the same context which the event is nested within.
+		std::size_t depth;
+
+		/// For End events, the time taken to resolve the binding. Otherwise, zero.
+		std::chrono::nanoseconds duration;
+
+		/// For End events, whether the binding was resolved rather than throwing an exception. Otherwise, true.
+		bool succeeded;
+	};
+
+	/// Keeps the most recent resolution events of each thread in a fixed-size ring buffer, so that what was being resolved
+	/// can be dumped after a failure, such as when a SerumException is caught, or on demand. Recording an event never locks
+	/// or allocates, once a thread's ring exists: it is a handful of relaxed atomic stores into the thread's own ring.
+	/// Reading the rings does not block recording; events overwritten while they are being read are skipped.
+	class FlightRecorder final : public SerumObserver
+	{
+		public:
+			/// The maximum number of characters of a binding name which are kept.
+			static constexpr std::size_t MaxNameLength = 24;
+
+			/// Initializes a new instance of the FlightRecorder class.
+			/// @param capacity The number of events kept per thread. It is rounded up to a power of two.
+			explicit FlightRecorder(std::size_t const capacity = 256)
+				: capacity(RoundUpToPowerOfTwo(std::max(capacity, std::size_t(1))))
+			{
+			}
+
+			/// Deleted copy constructor.
+			FlightRecorder(FlightRecorder const&) = delete;
+
+			/// Deleted copy assignment operator.
+			FlightRecorder& operator=(FlightRecorder const&) = delete;
+
+			/// Gets the number of events kept per thread.
+			/// @returns The capacity of each thread's ring.
+			[[nodiscard]] std::size_t GetCapacity() const noexcept
+			{
+				return capacity;
+			}
+
+			void OnResolveBegin(Bindings::BindingKey const& key, std::size_t const depth) override
+			{
+				auto* const ring = GetRing();
+				if (ring == nullptr)
+				{
+					return;
+				}
+
+				if (ring->openDepth < ring->openDepths.size())
+				{
+					ring->openDepths[ring->openDepth] = static_cast<std::uint32_t>(depth);
+				}
+
+				++ring->openDepth;
+				Record(*ring, key, FlightRecordType::Begin, depth, std::chrono::nanoseconds(0), true);
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds const duration, bool const succeeded) override
+			{
+				auto* const ring = GetRing();
+				if (ring == nullptr)
+				{
+					return;
+				}
+
+				auto depth = std::size_t(0);
+				if (ring->openDepth > 0)
+				{
+					--ring->openDepth;
+					depth = ring->openDepth < ring->openDepths.size() ? ring->openDepths[ring->openDepth] : ring->openDepth;
+				}
+
+				Record(*ring, key, FlightRecordType::End, depth, duration, succeeded);
+			}
+
+			/// Gets the events kept for every thread.
+			/// @returns The events, grouped by thread and ordered from oldest to newest within each thread.
+			[[nodiscard]] std::vector<FlightRecord> GetRecords() const
+			{
+				auto records = std::vector<FlightRecord>();
+
+				rings.ForEach([this, &records](auto const& slot)
+				{
+					auto const& ring = slot.state;
+					if (ring.entries == nullptr)
+					{
+						return;
+					}
+
+					auto const head = ring.head.load(std::memory_order_acquire);
+					auto const first = head > capacity ? head - capacity : 0;
+
+					for (auto sequence = first; sequence < head; ++sequence)
+					{
+						ReadEntry(ring.entries[sequence & (capacity - 1)], sequence, slot.threadIndex, records);
+					}
+				});
+
+				return records;
+			}
+
+			/// Writes the events kept for every thread as text, one event per line.
+			/// @param stream The stream to write to.
+			void Dump(std::ostream& stream) const
+			{
+				for (auto const& record : GetRecords())
+				{
+					stream << "thread " << record.threadIndex << " #" << record.sequence << ' '
+						   << std::string(record.depth * 2, ' ') << (record.type == FlightRecordType::Begin ? "begin " : "end ")
+						   << record.key;
+
+					if (record.type == FlightRecordType::End)
+					{
+						stream << (record.succeeded ? " succeeded in " : " failed after ") << record.duration.count() << "ns";
+					}
+
+					stream << '\n';
+				}
+			}
+
+			/// Gets the events kept for every thread as text, one event per line.
+			/// @returns The text.
+			[[nodiscard]] std::string ToString() const
+			{
+				auto stream = std::ostringstream();
+				Dump(stream);
+
+				return stream.str();
+			}
+
+		private:
+			static constexpr std::size_t NameWords = MaxNameLength / sizeof(std::uint64_t);
+			static constexpr std::size_t MaxTrackedDepth = 64;
+
+			// Every field is a relaxed atomic, and the sequence is odd while the entry is being written, so readers can
+			// copy an entry without a data race and discard it if it changed while they copied it.
+			struct alignas(64) Entry final
+			{
+				std::atomic<std::uint64_t> sequence{ 0 };
+				std::atomic<std::type_index> requestType{ std::type_index(typeid(void)) };
+				std::array<std::atomic<std::uint64_t>, NameWords> name{};
+				std::atomic<std::int64_t> duration{ 0 };
+				std::atomic<std::uint64_t> details{ 0 };
+			};
+
+			struct Ring final
+			{
+				std::unique_ptr<Entry[]> entries = nullptr;
+				std::atomic<std::uint64_t> head{ 0 };
+
+				// Only used by the owning thread.
+				std::size_t openDepth = 0;
+				std::array<std::uint32_t, MaxTrackedDepth> openDepths{};
+			};
+
+			std::size_t capacity;
+			Internal::PerThread<Ring> rings{};
+
+			// The details of an event are packed into one word: the name length, the type, whether it succeeded and the depth.
+			static constexpr std::uint64_t NameLengthMask = 0xFF;
+			static constexpr std::uint64_t EndFlag = std::uint64_t(1) << 8;
+			static constexpr std::uint64_t SucceededFlag = std::uint64_t(1) << 9;
+			static constexpr int DepthShift = 32;
+
+			[[nodiscard]] static constexpr std::size_t RoundUpToPowerOfTwo(std::size_t const value) noexcept
+			{
+				auto result = std::size_t(1);
+				while (result < value)
+				{
+					result <<= 1;
+				}
+
+				return result;
+			}
+
+			[[nodiscard]] Ring* GetRing() noexcept
+			{
+				// Observers must not throw, so events are dropped if the thread's ring cannot be created.
+				try
+				{
+					auto& slot = rings.GetLocal();
+					if (slot.state.entries == nullptr)
+					{
+						CreateEntries(slot);
+					}
+
+					return &slot.state;
+				}
+				catch (...)
+				{
+					return nullptr;
+				}
+			}
+
+			SERUM_NOINLINE void CreateEntries(Internal::PerThread<Ring>::Slot& slot) const
+			{
+				auto entries = std::unique_ptr<Entry[]>(new Entry[capacity]);
+
+				// Readers only look at a ring's entries while holding the slot's mutex.
+				auto const lock = std::lock_guard(slot.mutex);
+				slot.state.entries = std::move(entries);
+			}
+
+			// Stores a name in an entry's words without copying it through a buffer in memory a character at a time, which
+			// stalls when the words are read back. Names of at least one word are loaded a word at a time, with every word
+			// after the last full one ending at the last character, so it overlaps the word before it. Shorter names are
+			// assembled a character at a time. Words past the end of the name are left as they are.
+			static SERUM_NOINLINE void StoreName(Entry& entry, char const* const name, std::size_t const length) noexcept
+			{
+				if (length < sizeof(std::uint64_t))
+				{
+					auto word = std::uint64_t(0);
+					for (auto character = std::size_t(0); character < length; ++character)
+					{
+						word |= static_cast<std::uint64_t>(static_cast<unsigned char>(name[character])) << (character * 8);
+					}
+
+					entry.name[0].store(word, std::memory_order_relaxed);
+
+					return;
+				}
+
+				for (auto word = std::size_t(0); word < NameWords && word * sizeof(std::uint64_t) < length; ++word)
+				{
+					auto value = std::uint64_t(0);
+					std::memcpy(&value, name + std::min(word * sizeof(std::uint64_t), length - sizeof(std::uint64_t)), sizeof(value));
+					entry.name[word].store(value, std::memory_order_relaxed);
+				}
+			}
+
+			// The inverse of StoreName.
+			[[nodiscard]] static std::string UnpackName(std::array<std::uint64_t, NameWords> const& words, std::size_t const length)
+			{
+				auto name = std::string(length, '\0');
+				if (length < sizeof(std::uint64_t))
+				{
+					for (auto character = std::size_t(0); character < length; ++character)
+					{
+						name[character] = static_cast<char>(static_cast<unsigned char>(words[0] >> (character * 8)));
+					}
+
+					return name;
+				}
+
+				for (auto word = std::size_t(0); word < NameWords; ++word)
+				{
+					if (word * sizeof(std::uint64_t) < length)
+					{
+						std::memcpy(name.data() + std::min(word * sizeof(std::uint64_t), length - sizeof(std::uint64_t)), &words[word], sizeof(std::uint64_t));
+					}
+				}
+
+				return name;
+			}
+
+			void Record(
+				Ring& ring,
+				Bindings::BindingKey const& key,
+				FlightRecordType const type,
+				std::size_t const depth,
+				std::chrono::nanoseconds const duration,
+				bool const succeeded) noexcept
+			{
+				auto const sequence = ring.head.load(std::memory_order_relaxed);
+				auto& entry = ring.entries[sequence & (capacity - 1)];
+
+				auto const& name = key.GetName();
+				auto const nameLength = std::min(name.size(), MaxNameLength);
+
+				entry.sequence.store(sequence * 2 + 1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+
+				// Most bindings are unnamed, and readers ignore the words past the end of the name, so they are not written.
+				entry.requestType.store(key.GetRequestType(), std::memory_order_relaxed);
+				if (nameLength > 0)
+				{
+					StoreName(entry, name.data(), nameLength);
+				}
+
+				entry.duration.store(duration.count(), std::memory_order_relaxed);
+				entry.details.store(
+					static_cast<std::uint64_t>(nameLength)
+						| (type == FlightRecordType::End ? EndFlag : 0)
+						| (succeeded ? SucceededFlag : 0)
+						| (static_cast<std::uint64_t>(depth) << DepthShift),
+					std::memory_order_relaxed);
+
+				entry.sequence.store(sequence * 2 + 2, std::memory_order_release);
+				ring.head.store(sequence + 1, std::memory_order_release);
+			}
+
+			static void ReadEntry(
+				Entry const& entry,
+				std::uint64_t const sequence,
+				std::size_t const threadIndex,
+				std::vector<FlightRecord>& records)
+			{
+				auto const expectedSequence = sequence * 2 + 2;
+				if (entry.sequence.load(std::memory_order_acquire) != expectedSequence)
+				{
+					return;
+				}
+
+				auto const requestType = entry.requestType.load(std::memory_order_relaxed);
+				auto nameWords = std::array<std::uint64_t, NameWords>{};
+				for (auto word = std::size_t(0); word < NameWords; ++word)
+				{
+					nameWords[word] = entry.name[word].load(std::memory_order_relaxed);
+				}
+
+				auto const duration = entry.duration.load(std::memory_order_relaxed);
+				auto const details = entry.details.load(std::memory_order_relaxed);
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (entry.sequence.load(std::memory_order_relaxed) != expectedSequence)
+				{
+					return;
+				}
+
+				auto const name = UnpackName(nameWords, static_cast<std::size_t>(details & NameLengthMask));
+
+				auto const isEnd = (details & EndFlag) != 0;
+				records.push_back(FlightRecord{
+					Bindings::BindingKey(requestType, name),
+					isEnd ? FlightRecordType::End : FlightRecordType::Begin,
+					threadIndex,
+					sequence,
+					static_cast<std::size_t>(details >> DepthShift),
+					std::chrono::nanoseconds(duration),
+					!isEnd || (details & SucceededFlag) != 0
+				});
+			}
+	};
+}
+
+#endif // SERUM_HAS_OBSERVERS
+
+#endif // SERUM_OBSERVERS_FLIGHT_RECORDER_HPP
@@ -0,0 +1,355 @@
+/// @file HardwareCounterProfiler.hpp
+/// Defines an observer which attributes Linux perf_event hardware counters to the bindings being resolved.
+
+#ifndef SERUM_OBSERVERS_HARDWARE_COUNTER_PROFILER_HPP
+#define SERUM_OBSERVERS_HARDWARE_COUNTER_PROFILER_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/PerThread.hpp"
+#include "Serum/SerumObserver.hpp"
+
+#ifdef SERUM_HAS_PERF_EVENTS
+
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <unordered_map>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Serum::Observers
+{
+	/// The hardware counters and CPU time attributed to a binding by a HardwareCounterProfiler. Every value excludes
+	/// resolving the binding's dependencies, so it reflects the binding's own work, such as its constructor.
+	struct HardwareCounterStatistics final
+	{
+		/// The key of the binding.
+		Bindings::BindingKey key;
+
+		/// The number of times the binding has been resolved.
+		std::uint64_t resolveCount;
+
+		/// The CPU time spent by the resolving threads, measured with their CPU time clock.
+		std::chrono::nanoseconds cpuTime;
+
+		/// The number of CPU cycles, or 0 if hardware counters were unavailable.
+		std::uint64_t cycles;
+
+		/// The number of instructions retired, or 0 if hardware counters were unavailable.
+		std::uint64_t instructions;
+
+		/// The number of cache misses, or 0 if hardware counters were unavailable.
+		std::uint64_t cacheMisses;
+
+		/// Whether hardware counters were available for every resolution of the binding.
+		bool hasHardwareCounters;
+
+		/// Gets the number of instructions retired per CPU cycle. Low values suggest the binding is stalled on memory.
+		/// @returns The instructions per cycle, or 0 if no cycles were counted.
+		[[nodiscard]] double GetInstructionsPerCycle() const noexcept
+		{
+			return cycles == 0 ? 0.0 : static_cast<double>(instructions) / static_cast<double>(cycles);
+		}
+
+		/// Gets the number of cache misses per thousand instructions retired.
+		/// @returns The cache misses per thousand instructions, or 0 if no instructions were counted.
+		[[nodiscard]] double GetCacheMissesPerThousandInstructions() const noexcept
+		{
+			return instructions == 0 ? 0.0 : 1000.0 * static_cast<double>(cacheMisses) / static_cast<double>(instructions);
+		}
+	};
+
+	/// Reads the CPU cycles, instructions and cache misses counted by Linux perf_event around every observed resolution,
+	/// and attributes them to the binding's key, excluding its dependencies. Where perf_event_open is unavailable, such as
+	/// in many containers, only the thread CPU time clock is read. Each thread opens its own counters, which only count
+	/// that thread, and aggregates into its own table; the tables are merged on demand. Reading the counters costs system
+	/// calls, so this is intended for profiling builds rather than production.
+	class HardwareCounterProfiler final : public SerumObserver
+	{
+		public:
+			/// Initializes a new instance of the HardwareCounterProfiler class.
+			HardwareCounterProfiler() = default;
+
+			/// Deleted copy constructor.
+			HardwareCounterProfiler(HardwareCounterProfiler const&) = delete;
+
+			/// Deleted copy assignment operator.
+			HardwareCounterProfiler& operator=(HardwareCounterProfiler const&) = delete;
+
+			/// Gets whether hardware counters can be opened on the calling thread.
+			/// @returns True if perf_event_open provides hardware counters, and false otherwise.
+			[[nodiscard]] static bool AreHardwareCountersAvailable() noexcept
+			{
+				auto counters = ThreadCounters();
+				counters.Open();
+
+				return counters.hasHardwareCounters;
+			}
+
+			void OnResolveBegin(Bindings::BindingKey const& key, std::size_t const depth) override
+			{
+				auto& slot = threads.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+				auto& counters = slot.state;
+
+				// Observers must not throw, so anything which cannot be stored is dropped.
+				try
+				{
+					counters.Open();
+
+					// Bindings which wrap another binding with the same key, such as singletons, are counted as one resolution.
+					auto const isMerged = depth > 0 && !counters.openFrames.empty() && counters.openFrames.back().key == key;
+					counters.openFrames.push_back(OpenFrame{ key, depth, isMerged, CounterValues(), CounterValues() });
+					counters.openFrames.back().start = counters.Read();
+				}
+				catch (...)
+				{
+				}
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds const duration, bool const succeeded) override
+			{
+				(void)key;
+				(void)duration;
+				(void)succeeded;
+
+				auto& slot = threads.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+				auto& counters = slot.state;
+
+				if (counters.openFrames.empty())
+				{
+					return;
+				}
+
+				auto const end = counters.Read();
+				auto const frame = std::move(counters.openFrames.back());
+				counters.openFrames.pop_back();
+
+				auto* const parent = frame.depth == 0 || counters.openFrames.empty() ? nullptr : &counters.openFrames.back();
+
+				if (frame.isMerged)
+				{
+					// The wrapped binding's own work belongs to the wrapping frame, but its dependencies do not.
+					if (parent != nullptr)
+					{
+						parent->children += frame.children;
+					}
+
+					return;
+				}
+
+				auto const inclusive = end - frame.start;
+				if (parent != nullptr)
+				{
+					parent->children += inclusive;
+				}
+
+				try
+				{
+					auto& totals = counters.totals[frame.key];
+					++totals.resolveCount;
+					totals.hardwareResolveCount += counters.hasHardwareCounters ? 1 : 0;
+					totals.values += inclusive - frame.children;
+				}
+				catch (...)
+				{
+				}
+			}
+
+			/// Gets the counters attributed to each binding resolved so far, merged across threads.
+			/// @returns The statistics of each binding, in no particular order.
+			[[nodiscard]] std::vector<HardwareCounterStatistics> GetStatistics() const
+			{
+				auto merged = std::unordered_map<Bindings::BindingKey, Totals>();
+				threads.ForEach([&merged](auto const& slot)
+				{
+					for (auto const& [key, totals] : slot.state.totals)
+					{
+						auto& mergedTotals = merged[key];
+						mergedTotals.resolveCount += totals.resolveCount;
+						mergedTotals.hardwareResolveCount += totals.hardwareResolveCount;
+						mergedTotals.values += totals.values;
+					}
+				});
+
+				auto statistics = std::vector<HardwareCounterStatistics>();
+				statistics.reserve(merged.size());
+
+				for (auto const& [key, totals] : merged)
+				{
+					statistics.push_back(HardwareCounterStatistics{
+						key,
+						totals.resolveCount,
+						std::chrono::nanoseconds(totals.values.cpuNanoseconds),
+						totals.values.cycles,
+						totals.values.instructions,
+						totals.values.cacheMisses,
+						totals.hardwareResolveCount == totals.resolveCount
+					});
+				}
+
+				return statistics;
+			}
+
+			/// Discards the counters attributed so far. Resolutions in progress are still attributed when they finish.
+			void Clear()
+			{
+				threads.ForEach([](auto& slot)
+				{
+					slot.state.totals.clear();
+				});
+			}
+
+		private:
+			struct CounterValues final
+			{
+				std::uint64_t cpuNanoseconds = 0;
+				std::uint64_t cycles = 0;
+				std::uint64_t instructions = 0;
+				std::uint64_t cacheMisses = 0;
+
+				// Counters only increase, but a frame's children are measured separately from it, so differences saturate at zero.
+				CounterValues operator-(CounterValues const& other) const noexcept
+				{
+					auto const subtract = [](std::uint64_t const left, std::uint64_t const right)
+					{
+						return left > right ? left - right : 0;
+					};
+
+					return CounterValues{
+						subtract(cpuNanoseconds, other.cpuNanoseconds),
+						subtract(cycles, other.cycles),
+						subtract(instructions, other.instructions),
+						subtract(cacheMisses, other.cacheMisses)
+					};
+				}
+
+				CounterValues& operator+=(CounterValues const& other) noexcept
+				{
+					cpuNanoseconds += other.cpuNanoseconds;
+					cycles += other.cycles;
+					instructions += other.instructions;
+					cacheMisses += other.cacheMisses;
+
+					return *this;
+				}
+			};
+
+			struct OpenFrame final
+			{
+				Bindings::BindingKey key;
+				std::size_t depth;
+				bool isMerged;
+				CounterValues start;
+				CounterValues children;
+			};
+
+			struct Totals final
+			{
+				std::uint64_t resolveCount = 0;
+				std::uint64_t hardwareResolveCount = 0;
+				CounterValues values{};
+			};
+
+			struct ThreadCounters final
+			{
+				bool isOpened = false;
+				bool hasHardwareCounters = false;
+				int groupFd = -1;
+				int instructionsFd = -1;
+				int cacheMissesFd = -1;
+				std::vector<OpenFrame> openFrames{};
+				std::unordered_map<Bindings::BindingKey, Totals> totals{};
+
+				ThreadCounters() = default;
+				ThreadCounters(ThreadCounters const&) = delete;
+				ThreadCounters& operator=(ThreadCounters const&) = delete;
+
+				~ThreadCounters()
+				{
+					Close();
+				}
+
+				// The counters count the thread which opens them, so they are opened by each thread on its first resolution.
+				void Open() noexcept
+				{
+					if (isOpened)
+					{
+						return;
+					}
+
+					isOpened = true;
+					groupFd = OpenCounter(PERF_COUNT_HW_CPU_CYCLES, -1);
+					instructionsFd = groupFd == -1 ? -1 : OpenCounter(PERF_COUNT_HW_INSTRUCTIONS, groupFd);
+					cacheMissesFd = instructionsFd == -1 ? -1 : OpenCounter(PERF_COUNT_HW_CACHE_MISSES, groupFd);
+					hasHardwareCounters = cacheMissesFd != -1;
+
+					if (!hasHardwareCounters)
+					{
+						Close();
+					}
+				}
+
+				void Close() noexcept
+				{
+					for (auto* const fd : { &cacheMissesFd, &instructionsFd, &groupFd })
+					{
+						if (*fd != -1)
+						{
+							::close(*fd);
+							*fd = -1;
+						}
+					}
+				}
+
+				[[nodiscard]] CounterValues Read() const noexcept
+				{
+					auto values = CounterValues();
+
+					if (hasHardwareCounters)
+					{
+						// With PERF_FORMAT_GROUP, one read returns the number of counters followed by each counter's value.
+						std::uint64_t buffer[4] = {};
+						if (::read(groupFd, buffer, sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer)) && buffer[0] == 3)
+						{
+							values.cycles = buffer[1];
+							values.instructions = buffer[2];
+							values.cacheMisses = buffer[3];
+						}
+					}
+
+					auto time = timespec();
+					if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) == 0)
+					{
+						values.cpuNanoseconds = static_cast<std::uint64_t>(time.tv_sec) * 1000000000 + static_cast<std::uint64_t>(time.tv_nsec);
+					}
+
+					return values;
+				}
+
+				[[nodiscard]] static int OpenCounter(std::uint64_t const config, int const groupFd) noexcept
+				{
+					auto attributes = perf_event_attr();
+					std::memset(&attributes, 0, sizeof(attributes));
+					attributes.size = sizeof(attributes);
+					attributes.type = PERF_TYPE_HARDWARE;
+					attributes.config = config;
+					attributes.read_format = PERF_FORMAT_GROUP;
+					attributes.exclude_kernel = 1;
+					attributes.exclude_hv = 1;
+
+					return static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+				}
+			};
+
+			Internal::PerThread<ThreadCounters> threads{};
+	};
+}
+
+#endif // SERUM_HAS_PERF_EVENTS
+
+#endif // SERUM_OBSERVERS_HARDWARE_COUNTER_PROFILER_HPP
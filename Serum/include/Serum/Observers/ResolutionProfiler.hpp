@@ -0,0 +1,289 @@
+/// @file ResolutionProfiler.hpp
+/// Defines an observer which profiles the time spent resolving each path of bindings.
+
+#ifndef SERUM_OBSERVERS_RESOLUTION_PROFILER_HPP
+#define SERUM_OBSERVERS_RESOLUTION_PROFILER_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/PerThread.hpp"
+#include "Serum/SerumObserver.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace Serum::Observers
+{
+	/// The time reported for each stack by a ResolutionProfiler.
+	enum class ProfileTime
+	{
+		/// The time spent in the bindings' own resolution, excluding their dependencies.
+		/// This is what flame graph tools expect, as they add the time of each stack's children to it.
+		Exclusive,
+
+		/// The time spent resolving the bindings, including their dependencies.
+		Inclusive
+	};
+
+	/// The profile of a unique path of bindings.
+	struct ProfiledStack final
+	{
+		/// The keys of the bindings on the path, from the binding requested from the container to the profiled binding.
+		std::vector<Bindings::BindingKey> path;
+
+		/// The number of times the path was resolved.
+		std::uint64_t resolveCount;
+
+		/// The total time spent resolving the binding on this path, including its dependencies.
+		std::chrono::nanoseconds inclusiveTime;
+
+		/// The total time spent resolving the binding on this path, excluding its dependencies.
+		std::chrono::nanoseconds exclusiveTime;
+	};
+
+	/// Profiles every observed resolution, aggregating the inclusive and exclusive time spent resolving each unique path
+	/// of bindings, and writes the result as folded stacks for flame graph tools. Each thread aggregates into its own
+	/// tree of paths, and the trees are merged on demand.
+	class ResolutionProfiler final : public SerumObserver
+	{
+		public:
+			/// Initializes a new instance of the ResolutionProfiler class.
+			ResolutionProfiler() = default;
+
+			/// Deleted copy constructor.
+			ResolutionProfiler(ResolutionProfiler const&) = delete;
+
+			/// Deleted copy assignment operator.
+			ResolutionProfiler& operator=(ResolutionProfiler const&) = delete;
+
+			void OnResolveBegin(Bindings::BindingKey const& key, std::size_t const depth) override
+			{
+				auto& slot = profiles.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+				auto& profile = slot.state;
+
+				// Observers must not throw, so anything which cannot be stored is dropped.
+				try
+				{
+					// A resolution at depth 0 starts a new resolution context, so it is the root of its own path.
+					auto const parent = depth == 0 || profile.openFrames.empty()
+						? RootNode
+						: profile.openFrames.back().node;
+
+					// Bindings which wrap another binding with the same key, such as singletons, are profiled as one frame.
+					if (parent != RootNode && profile.nodes[parent].key == key)
+					{
+						profile.openFrames.push_back(OpenFrame{ parent, depth, std::chrono::nanoseconds(0), true });
+						return;
+					}
+
+					profile.openFrames.push_back(OpenFrame{ profile.GetChild(parent, key), depth, std::chrono::nanoseconds(0), false });
+				}
+				catch (...)
+				{
+				}
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds const duration, bool const succeeded) override
+			{
+				(void)key;
+				(void)succeeded;
+
+				auto& slot = profiles.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+				auto& profile = slot.state;
+
+				if (profile.openFrames.empty())
+				{
+					return;
+				}
+
+				auto const frame = profile.openFrames.back();
+				profile.openFrames.pop_back();
+
+				auto* const parentFrame = frame.depth == 0 || profile.openFrames.empty() ? nullptr : &profile.openFrames.back();
+
+				if (frame.isMerged)
+				{
+					// The wrapped binding's own time belongs to the wrapping frame, but its dependencies do not.
+					if (parentFrame != nullptr)
+					{
+						parentFrame->childTime += frame.childTime;
+					}
+
+					return;
+				}
+
+				auto& node = profile.nodes[frame.node];
+				++node.resolveCount;
+				node.inclusiveTime += duration;
+				node.exclusiveTime += duration > frame.childTime ? duration - frame.childTime : std::chrono::nanoseconds(0);
+
+				if (parentFrame != nullptr)
+				{
+					parentFrame->childTime += duration;
+				}
+			}
+
+			/// Gets the profile of every unique path of bindings resolved so far, merged across threads.
+			/// @returns The profiled stacks, ordered by path.
+			[[nodiscard]] std::vector<ProfiledStack> GetStacks() const
+			{
+				auto stacks = std::vector<ProfiledStack>();
+				auto indices = std::unordered_map<std::string, std::size_t>();
+
+				profiles.ForEach([&stacks, &indices](auto const& slot)
+				{
+					auto const& nodes = slot.state.nodes;
+
+					for (auto nodeIndex = RootNode + 1; nodeIndex < nodes.size(); ++nodeIndex)
+					{
+						auto path = std::vector<Bindings::BindingKey>();
+						for (auto pathIndex = nodeIndex; pathIndex != RootNode; pathIndex = nodes[pathIndex].parent)
+						{
+							path.push_back(nodes[pathIndex].key);
+						}
+
+						std::reverse(path.begin(), path.end());
+
+						auto const [iterator, isNew] = indices.try_emplace(ToFoldedPath(path), stacks.size());
+						if (isNew)
+						{
+							stacks.push_back(ProfiledStack{ std::move(path), 0, std::chrono::nanoseconds(0), std::chrono::nanoseconds(0) });
+						}
+
+						auto& stack = stacks[iterator->second];
+						stack.resolveCount += nodes[nodeIndex].resolveCount;
+						stack.inclusiveTime += nodes[nodeIndex].inclusiveTime;
+						stack.exclusiveTime += nodes[nodeIndex].exclusiveTime;
+					}
+				});
+
+				std::sort(stacks.begin(), stacks.end(), [](ProfiledStack const& left, ProfiledStack const& right)
+				{
+					return ToFoldedPath(left.path) < ToFoldedPath(right.path);
+				});
+
+				return stacks;
+			}
+
+			/// Discards the profile recorded so far. Resolutions in progress are still profiled when they finish.
+			void Clear()
+			{
+				profiles.ForEach([](auto& slot)
+				{
+					for (auto& node : slot.state.nodes)
+					{
+						node.resolveCount = 0;
+						node.inclusiveTime = std::chrono::nanoseconds(0);
+						node.exclusiveTime = std::chrono::nanoseconds(0);
+					}
+				});
+			}
+
+			/// Writes the profile as folded stacks, with one line per path of the form "A;B;C 1234", where the frames are
+			/// the binding keys and the value is in nanoseconds. Paths which were not resolved since the profile was last
+			/// cleared are omitted. The output can be passed to flamegraph.pl, inferno or speedscope.
+			/// @param stream The stream to write to.
+			/// @param time The time to report for each path.
+			void WriteFoldedStacks(std::ostream& stream, ProfileTime const time = ProfileTime::Exclusive) const
+			{
+				for (auto const& stack : GetStacks())
+				{
+					if (stack.resolveCount == 0)
+					{
+						continue;
+					}
+
+					auto const value = time == ProfileTime::Inclusive ? stack.inclusiveTime : stack.exclusiveTime;
+					stream << ToFoldedPath(stack.path) << ' ' << value.count() << '\n';
+				}
+			}
+
+			/// Gets the profile as folded stacks.
+			/// @param time The time to report for each path.
+			/// @returns The folded stacks.
+			[[nodiscard]] std::string ToFoldedStacks(ProfileTime const time = ProfileTime::Exclusive) const
+			{
+				auto stream = std::ostringstream();
+				WriteFoldedStacks(stream, time);
+
+				return stream.str();
+			}
+
+		private:
+			static constexpr std::size_t RootNode = 0;
+
+			struct Node final
+			{
+				Bindings::BindingKey key;
+				std::size_t parent;
+				std::unordered_map<Bindings::BindingKey, std::size_t> children{};
+				std::uint64_t resolveCount = 0;
+				std::chrono::nanoseconds inclusiveTime{ 0 };
+				std::chrono::nanoseconds exclusiveTime{ 0 };
+			};
+
+			struct OpenFrame final
+			{
+				std::size_t node;
+				std::size_t depth;
+				std::chrono::nanoseconds childTime;
+				bool isMerged;
+			};
+
+			// Each thread's paths are stored as a tree, so that resolving a binding only looks up the binding
+			// among the children of the binding which resolved it, rather than building its whole path.
+			struct ThreadProfile final
+			{
+				std::vector<Node> nodes{ Node{ Bindings::BindingKey(typeid(void), ""), RootNode } };
+				std::vector<OpenFrame> openFrames{};
+
+				std::size_t GetChild(std::size_t const parent, Bindings::BindingKey const& key)
+				{
+					auto const iterator = nodes[parent].children.find(key);
+					if (iterator != nodes[parent].children.end())
+					{
+						return iterator->second;
+					}
+
+					auto const child = nodes.size();
+					nodes.push_back(Node{ key, parent });
+					nodes[parent].children.emplace(key, child);
+
+					return child;
+				}
+			};
+
+			Internal::PerThread<ThreadProfile> profiles{};
+
+			[[nodiscard]] static std::string ToFoldedPath(std::vector<Bindings::BindingKey> const& path)
+			{
+				auto folded = std::string();
+
+				for (auto const& key : path)
+				{
+					if (!folded.empty())
+					{
+						folded += ';';
+					}
+
+					// Semicolons separate frames and a space separates the value, so neither is left in a frame.
+					auto frame = key.ToString();
+					std::replace(frame.begin(), frame.end(), ';', ':');
+					std::replace(frame.begin(), frame.end(), ' ', '_');
+					folded += frame;
+				}
+
+				return folded;
+			}
+	};
+}
+
+#endif // SERUM_HAS_OBSERVERS
+
+#endif // SERUM_OBSERVERS_RESOLUTION_PROFILER_HPP
@@ -0,0 +1,235 @@
+/// @file TraceRecorder.hpp
+/// Defines an observer which records resolutions and writes them as a Chrome trace.
+
+#ifndef SERUM_OBSERVERS_TRACE_RECORDER_HPP
+#define SERUM_OBSERVERS_TRACE_RECORDER_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/Json.hpp"
+#include "Serum/Internal/PerThread.hpp"
+#include "Serum/SerumObserver.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+namespace Serum::Observers
+{
+	/// The kinds of event recorded by a TraceRecorder.
+	enum class TraceEventType
+	{
+		/// A binding was resolved.
+		Resolution,
+
+		/// A singleton binding constructed its instance.
+		SingletonCreation
+	};
+
+	/// An event recorded by a TraceRecorder.
+	struct TraceEvent final
+	{
+		/// The key of the binding.
+		Bindings::BindingKey key;
+
+		/// The kind of event.
+		TraceEventType type;
+
+		/// The time the event started, relative to when the recorder was created.
+		std::chrono::nanoseconds start;
+
+		/// The duration of the event.
+		std::chrono::nanoseconds duration;
+
+		/// The index of the thread the event was recorded on, starting from 1 in the order threads first recorded an event.
+		std::size_t threadIndex;
+
+		/// The number of resolutions in progress which the event is nested within.
+		std::size_t depth;
+
+		/// Whether the resolution succeeded. This is always true for singleton creations.
+		bool succeeded;
+	};
+
+	/// Records every observed resolution with its start time, duration, thread and nesting depth, and writes them
+	/// in the Chrome trace event format, which can be loaded into chrome://tracing or the Perfetto UI.
+	/// Each thread records into its own buffer, so recording does not serialize resolutions on different threads.
+	class TraceRecorder final : public SerumObserver
+	{
+		public:
+			/// Initializes a new instance of the TraceRecorder class. Event times are relative to its creation.
+			TraceRecorder() noexcept
+				: origin(std::chrono::steady_clock::now())
+			{
+			}
+
+			/// Deleted copy constructor.
+			TraceRecorder(TraceRecorder const&) = delete;
+
+			/// Deleted copy assignment operator.
+			TraceRecorder& operator=(TraceRecorder const&) = delete;
+
+			void OnResolveBegin(Bindings::BindingKey const& key, std::size_t const depth) override
+			{
+				(void)key;
+
+				auto& slot = buffers.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+
+				// Observers must not throw, so anything which cannot be stored is dropped.
+				try
+				{
+					slot.state.openDepths.push_back(depth);
+				}
+				catch (...)
+				{
+				}
+			}
+
+			void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds const duration, bool const succeeded) override
+			{
+				auto& slot = buffers.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+				auto& buffer = slot.state;
+
+				auto depth = std::size_t(0);
+				if (!buffer.openDepths.empty())
+				{
+					depth = buffer.openDepths.back();
+					buffer.openDepths.pop_back();
+				}
+
+				Record(buffer, TraceEvent{ key, TraceEventType::Resolution, GetStart(duration), duration, slot.threadIndex, depth, succeeded });
+			}
+
+			void OnSingletonCreated(Bindings::BindingKey const& key, std::chrono::nanoseconds const duration) override
+			{
+				auto& slot = buffers.GetLocal();
+				auto const lock = std::lock_guard(slot.mutex);
+				auto& buffer = slot.state;
+
+				// The singleton's own resolution is still open, so its construction is nested one level within it.
+				auto const depth = buffer.openDepths.empty() ? std::size_t(0) : buffer.openDepths.back() + 1;
+
+				Record(buffer, TraceEvent{ key, TraceEventType::SingletonCreation, GetStart(duration), duration, slot.threadIndex, depth, true });
+			}
+
+			/// Gets the events recorded so far on every thread.
+			/// @returns The events, ordered by start time.
+			[[nodiscard]] std::vector<TraceEvent> GetEvents() const
+			{
+				auto events = std::vector<TraceEvent>();
+				buffers.ForEach([&events](auto const& slot)
+				{
+					events.insert(events.end(), slot.state.events.begin(), slot.state.events.end());
+				});
+
+				std::stable_sort(events.begin(), events.end(), [](TraceEvent const& left, TraceEvent const& right)
+				{
+					return left.start < right.start;
+				});
+
+				return events;
+			}
+
+			/// Discards the events recorded so far.
+			void Clear()
+			{
+				buffers.ForEach([](auto& slot)
+				{
+					slot.state.events.clear();
+				});
+			}
+
+			/// Writes the events recorded so far as a Chrome trace event JSON document. Resolutions are written as complete
+			/// events in the "resolve" category and singleton creations in the "singleton" category, with timestamps in
+			/// microseconds. Each thread which recorded an event is named "Serum thread N".
+			/// @param stream The stream to write to.
+			void WriteChromeTrace(std::ostream& stream) const
+			{
+				auto const events = GetEvents();
+				auto const numberOfThreads = buffers.GetNumberOfThreads();
+
+				stream << "{\"traceEvents\":[";
+
+				for (auto threadIndex = std::size_t(1); threadIndex <= numberOfThreads; ++threadIndex)
+				{
+					stream << (threadIndex == 1 ? "\n" : ",\n")
+						   << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadIndex
+						   << ",\"args\":{\"name\":\"Serum thread " << threadIndex << "\"}}";
+				}
+
+				for (auto const& event : events)
+				{
+					auto const isResolution = event.type == TraceEventType::Resolution;
+
+					stream << ",\n{\"name\":" << Internal::ToJsonString(event.key.ToString())
+						   << ",\"cat\":\"" << (isResolution ? "resolve" : "singleton") << "\",\"ph\":\"X\",\"ts\":";
+					WriteMicroseconds(stream, event.start);
+					stream << ",\"dur\":";
+					WriteMicroseconds(stream, event.duration);
+					stream << ",\"pid\":1,\"tid\":" << event.threadIndex
+						   << ",\"args\":{\"depth\":" << event.depth;
+
+					if (isResolution)
+					{
+						stream << ",\"succeeded\":" << (event.succeeded ? "true" : "false");
+					}
+
+					stream << "}}";
+				}
+
+				stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+			}
+
+			/// Gets the events recorded so far as a Chrome trace event JSON document.
+			/// @returns The JSON document.
+			[[nodiscard]] std::string ToChromeTrace() const
+			{
+				auto stream = std::ostringstream();
+				WriteChromeTrace(stream);
+
+				return stream.str();
+			}
+
+		private:
+			struct ThreadBuffer final
+			{
+				std::vector<TraceEvent> events{};
+				std::vector<std::size_t> openDepths{};
+			};
+
+			std::chrono::steady_clock::time_point origin;
+			Internal::PerThread<ThreadBuffer> buffers{};
+
+			[[nodiscard]] std::chrono::nanoseconds GetStart(std::chrono::nanoseconds const duration) const noexcept
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin) - duration;
+			}
+
+			static void Record(ThreadBuffer& buffer, TraceEvent event) noexcept
+			{
+				try
+				{
+					buffer.events.push_back(std::move(event));
+				}
+				catch (...)
+				{
+				}
+			}
+
+			static void WriteMicroseconds(std::ostream& stream, std::chrono::nanoseconds const time)
+			{
+				auto const nanoseconds = time.count() < 0 ? 0 : time.count();
+				auto const fraction = nanoseconds % 1000;
+
+				stream << nanoseconds / 1000 << '.' << fraction / 100 << fraction / 10 % 10 << fraction % 10;
+			}
+	};
+}
+
+#endif // SERUM_HAS_OBSERVERS
+
+#endif // SERUM_OBSERVERS_TRACE_RECORDER_HPP
@@ -5,21 +5,29 @@
 #define SERUM_RESOLUTION_CONTEXT_HPP
 
 #include "Serum/Internal/Common.hpp"
-#include "Bindings/BindingKey.hpp"
+#include "Serum/Bindings/BindingKey.hpp"
+#include "Serum/Internal/SmallVector.hpp"
+#include "Serum/Internal/ResolutionPathEntry.hpp"
+#include "Serum/Internal/BindingIdSet.hpp"
+
+#ifdef SERUM_ENABLE_METRICS
+#include "Serum/Metrics/BindingMetrics.hpp"
+#endif
+
+#include <any>
+#include <vector>
 
 namespace Serum
 {
-	namespace Bindings
-	{
-		template <typename TRequest>
-		class Binding;
-	}
-
-	/// Stores contextual information about a binding as it is resolved.
+	/// Stores contextual information about a binding as it is resolved. The information available depends
+	/// on the configured ResolutionTracking level - unless it is Full, the resolution path is always empty.
+	/// Per-resolution bindings are memoized in the context, so they are shared for as long as it lives.
 	class ResolutionContext final
 	{
+		friend class Bindings::BindingBase;
+
 		template <typename TRequest>
-		friend class Bindings::Binding;
+		friend class Bindings::PerResolutionBinding;
 
 		public:
 			/// Initializes a new instance of the resolution context class.
@@ -29,7 +37,7 @@ namespace Serum
 			/// @returns The key of the binding that is making the request.
 			[[nodiscard]] auto GetRequestingBinding() const
 			{
-				if (resolutionPath.empty())
+				if (resolutionPath.Empty())
 				{
 					throw SerumException("Cannot get requesting type - resolution path is empty.");
 				}
@@ -37,27 +45,135 @@ namespace Serum
 				// The context will include the current binding as it is being resolved, so the previous
 				// binding needs to be checked.
 
-				return resolutionPath[resolutionPath.size() - 1];
+				return resolutionPath.Back().ToBindingKey();
 			}
 
 			/// Checks whether or not the resolution path contains a key with the given type.
 			/// @returns true if the resolution path contains a key with the given type, false otherwise.
-			[[nodiscard]] auto ResolutionPathContainsType(std::type_info const& type) const
+			[[nodiscard]] bool ResolutionPathContainsType(std::type_info const& type) const
 			{
-				auto const key = Bindings::BindingKey(type, "");
-
-				return std::find(resolutionPath.begin(), resolutionPath.end(), key) != resolutionPath.end();
+				return ResolutionPathContainsKey(Bindings::BindingKey(type, ""));
 			}
 
-			/// Checks whether or not the resolution path contains the given key.
+			/// Checks whether or not the resolution path contains the given key. The key is hashed once, and each
+			/// entry is only compared with it if their hashes match.
 			/// @returns true if the resolution path contains the given key, false otherwise.
-			[[nodiscard]] auto ResolutionPathContainsKey(Bindings::BindingKey const& key) const
+			[[nodiscard]] bool ResolutionPathContainsKey(Bindings::BindingKey const& key) const
+			{
+				auto const keyHash = std::hash<Bindings::BindingKey>{}(key);
+				for (auto const& entry : resolutionPath)
+				{
+					if (entry.HasKey(key, keyHash))
+					{
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			/// Gets the number of bindings currently being resolved in this context. This is always 0 when
+			/// resolution tracking is disabled.
+			/// @returns The depth of the resolution path.
+			[[nodiscard]] std::size_t GetResolutionDepth() const noexcept
 			{
-				return std::find(resolutionPath.begin(), resolutionPath.end(), key) != resolutionPath.end();
+				return activeBindings.Size();
 			}
 
+#ifdef SERUM_HAS_OBSERVERS
+			/// Sets the observer notified of resolutions in this context. Containers attach their own observer
+			/// to contexts which do not already have one.
+			/// @param contextObserver The observer. May be null. It must outlive any resolution in this context.
+			void SetObserver(SerumObserver* const contextObserver) noexcept
+			{
+				observer = contextObserver;
+			}
+
+			/// Gets the observer notified of resolutions in this context.
+			/// @returns The observer, or null if resolutions in this context are not observed.
+			[[nodiscard]] SerumObserver* GetObserver() const noexcept
+			{
+				return observer;
+			}
+#endif
+
 		private:
-			std::vector<Bindings::BindingKey> resolutionPath{};
+			/// An instance of a per-resolution binding that has already been resolved in this context.
+			struct MemoizedInstance final
+			{
+				Internal::BindingId bindingId;
+				std::any value;
+			};
+
+			/// The number of path entries stored inline before the path spills to the heap.
+			static constexpr std::size_t InlinePathCapacity = 32;
+
+			/// The number of memoized instances stored inline before they spill to the heap.
+			static constexpr std::size_t InlineMemoizedInstanceCapacity = 4;
+
+			Internal::SmallVector<Internal::ResolutionPathEntry, InlinePathCapacity> resolutionPath{};
+			Internal::BindingIdSet activeBindings{};
+			Internal::SmallVector<MemoizedInstance, InlineMemoizedInstanceCapacity> memoizedInstances{};
+
+#ifdef SERUM_HAS_OBSERVERS
+			SerumObserver* observer = nullptr;
+
+			/// The number of observed resolutions in progress in the context.
+			std::size_t observedDepth = 0;
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+			/// The innermost resolution in progress in the context.
+			Metrics::ResolutionFrame* metricsFrame = nullptr;
+#endif
+
+			template <typename TRequest>
+			[[nodiscard]] TRequest const* FindMemoizedInstance(Internal::BindingId const bindingId) const noexcept
+			{
+				for (auto const& instance : memoizedInstances)
+				{
+					if (instance.bindingId == bindingId)
+					{
+						return std::any_cast<TRequest>(&instance.value);
+					}
+				}
+
+				return nullptr;
+			}
+
+			template <typename TRequest>
+			void MemoizeInstance(Internal::BindingId const bindingId, TRequest const& value)
+			{
+				memoizedInstances.EmplaceBack(MemoizedInstance{ bindingId, std::any(value) });
+			}
+
+			[[nodiscard]] Internal::ResolutionPathEntry const* FindPathEntry(Internal::ResolutionPathEntry const& entry) const noexcept
+			{
+				for (auto const& pathEntry : resolutionPath)
+				{
+					if (pathEntry == entry)
+					{
+						return &pathEntry;
+					}
+				}
+
+				return resolutionPath.end();
+			}
+
+			[[nodiscard]] std::vector<Bindings::BindingKey> GetCycle(Internal::ResolutionPathEntry const& repeatedEntry) const
+			{
+				auto const first = FindPathEntry(repeatedEntry);
+
+				auto cycle = std::vector<Bindings::BindingKey>();
+				for (auto entry = first; entry != resolutionPath.end(); ++entry)
+				{
+					cycle.push_back(entry->ToBindingKey());
+				}
+
+				cycle.push_back(repeatedEntry.ToBindingKey());
+
+				return cycle;
+			}
 	};
 }
 
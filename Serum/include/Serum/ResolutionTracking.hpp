@@ -0,0 +1,36 @@
+/// @file ResolutionTracking.hpp
+/// Defines the levels of tracking performed as bindings are resolved.
+
+#ifndef SERUM_RESOLUTION_TRACKING_HPP
+#define SERUM_RESOLUTION_TRACKING_HPP
+
+#include "Serum/Internal/Common.hpp"
+
+namespace Serum
+{
+	/// An enumeration for the levels of tracking performed as bindings are resolved.
+	enum class ResolutionTracking
+	{
+		/// Nothing is tracked, so resolving a binding directly calls its ResolveCore method.
+		/// Cycles are not detected and the resolution path is always empty.
+		None = SERUM_RESOLUTION_TRACKING_NONE,
+
+		/// Only the bindings being resolved are tracked, which is enough to detect cycles.
+		/// The resolution path is always empty.
+		Cycles = SERUM_RESOLUTION_TRACKING_CYCLES,
+
+		/// The full resolution path is tracked and cycles are detected.
+		Full = SERUM_RESOLUTION_TRACKING_FULL
+	};
+
+	/// The resolution tracking level Serum has been compiled with, selected by SERUM_RESOLUTION_TRACKING.
+	inline constexpr auto ConfiguredResolutionTracking = static_cast<ResolutionTracking>(SERUM_RESOLUTION_TRACKING);
+
+	static_assert(
+		ConfiguredResolutionTracking == ResolutionTracking::None
+			|| ConfiguredResolutionTracking == ResolutionTracking::Cycles
+			|| ConfiguredResolutionTracking == ResolutionTracking::Full,
+		"SERUM_RESOLUTION_TRACKING must be one of the SERUM_RESOLUTION_TRACKING_* values.");
+}
+
+#endif // SERUM_RESOLUTION_TRACKING_HPP
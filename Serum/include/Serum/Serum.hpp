@@ -5,7 +5,19 @@
 #define SERUM_SERUM_HPP
 
 #include "Serum/Internal/Common.hpp"
+#include "Serum/ResolutionTracking.hpp"
 #include "Serum/SerumResolver.hpp"
+#include "Serum/SerumObserver.hpp"
+#include "Serum/Observers/CompositeObserver.hpp"
+#include "Serum/Observers/TraceRecorder.hpp"
+#include "Serum/Observers/DependencyGraphRecorder.hpp"
+#include "Serum/Observers/ResolutionProfiler.hpp"
+#include "Serum/Observers/FlightRecorder.hpp"
+#include "Serum/Observers/HardwareCounterProfiler.hpp"
+#include "Serum/AsyncSerumResolver.hpp"
+#include "Serum/Async/ThreadPoolExecutor.hpp"
+#include "Serum/DependencyGraph.hpp"
 #include "Serum/SerumContainer.hpp"
+#include "Serum/StaticContainer.hpp"
 
 #endif // SERUM_SERUM_HPP
\ No newline at end of file
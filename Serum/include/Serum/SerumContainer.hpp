@@ -7,7 +7,23 @@
 #include "Serum/Internal/Common.hpp"
 #include "Serum/Internal/AnyBindingWrapper.hpp"
 #include "Serum/Internal/TypeTraits.hpp"
+#include "Serum/Internal/Injection.hpp"
 #include "Serum/Bindings/BindingKey.hpp"
+#include "Serum/DependencyGraph.hpp"
+
+#include <array>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#ifdef SERUM_HAS_OBSERVERS
+#include "Serum/SerumObserver.hpp"
+#include "Serum/Observers/DependencyGraphRecorder.hpp"
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+#include "Serum/Metrics/BindingStatistics.hpp"
+#endif
 
 namespace Serum
 {
@@ -27,7 +43,7 @@ namespace Serum
 			/// @returns The resolved service.
 			/// @throws SerumException If no matching bindings exist.
 			template <typename TRequest>
-			[[nodiscard]] auto Get(std::string const& name = "")
+			[[nodiscard]] TRequest Get(std::string const& name = "")
 			{
 				auto resolutionContext = ResolutionContext();
 
@@ -41,18 +57,134 @@ namespace Serum
 			/// @returns The resolved service.
 			/// @throws SerumException If no matching bindings exist.
 			template <typename TRequest>
-			[[nodiscard]] auto Get(ResolutionContext& resolutionContext, std::string const& name = "")
+			[[nodiscard]] TRequest Get(ResolutionContext& resolutionContext, std::string const& name = "")
 			{
 				return this->GetCore<TRequest>(resolutionContext, name);
 			}
 
+#ifdef SERUM_HAS_COROUTINES
+			/// Resolves a bound service from the container asynchronously. Asynchronous resolver bindings
+			/// are resumed on their own executor or, if they do not have one, the container's executor.
+			/// All other bindings are resolved synchronously when the task is awaited.
+			/// @tparam TRequest The type of the service to request.
+			/// @param name Optionally, the name of the binding.
+			/// @returns A task which produces the resolved service.
+			/// @throws SerumException If no matching bindings exist.
+			template <typename TRequest>
+			[[nodiscard]] Async::Task<TRequest> GetAsync(std::string name = "")
+			{
+				auto resolutionContext = ResolutionContext();
+
+				co_return co_await this->GetAsyncCore<TRequest>(resolutionContext, std::move(name));
+			}
+
+			/// Resolves a bound service from the container asynchronously. Asynchronous resolver bindings
+			/// are resumed on their own executor or, if they do not have one, the container's executor.
+			/// All other bindings are resolved synchronously when the task is awaited.
+			/// @tparam TRequest The type of the service to request.
+			/// @param resolutionContext The resolution context. This must outlive the returned task.
+			/// @param name Optionally, the name of the binding.
+			/// @returns A task which produces the resolved service.
+			/// @throws SerumException If no matching bindings exist.
+			template <typename TRequest>
+			[[nodiscard]] Async::Task<TRequest> GetAsync(ResolutionContext& resolutionContext, std::string name = "")
+			{
+				return this->GetAsyncCore<TRequest>(resolutionContext, std::move(name));
+			}
+
+			/// Sets the executor that asynchronous resolver bindings without their own executor are resumed on.
+			/// If no executor is set, such bindings are resumed on the thread which awaits them.
+			/// @param containerExecutor The executor. May be null.
+			/// @returns The container instance.
+			auto& SetExecutor(std::shared_ptr<Async::SerumExecutor> containerExecutor) noexcept
+			{
+				executor = std::move(containerExecutor);
+
+				return *this;
+			}
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+			/// Sets the observer notified of resolutions from the container. Resolution contexts which already
+			/// have an observer keep their own. Use Observers::CompositeObserver to attach several observers.
+			/// @param containerObserver The observer. May be null, in which case resolutions are not observed.
+			/// @returns The container instance.
+			auto& SetObserver(std::shared_ptr<SerumObserver> containerObserver) noexcept
+			{
+				observer = std::move(containerObserver);
+
+				return *this;
+			}
+
+			/// Gets the observer notified of resolutions from the container.
+			/// @returns The observer, or null if resolutions from the container are not observed.
+			[[nodiscard]] std::shared_ptr<SerumObserver> const& GetObserver() const noexcept
+			{
+				return observer;
+			}
+#endif
+
+			/// Resolves several bound services from the container in a single call. All bindings are looked
+			/// up before any are resolved, and every service is resolved in the same resolution context.
+			/// @tparam TRequests The types of the services to request.
+			/// @returns A tuple of the resolved services, in the order they were requested.
+			/// @throws SerumException If no matching binding exists for any of the requested services.
+			template <typename... TRequests>
+			[[nodiscard]] auto GetMany()
+			{
+				auto resolutionContext = ResolutionContext();
+
+				return this->GetMany<TRequests...>(resolutionContext);
+			}
+
+			/// Resolves several bound services from the container in a single call. All bindings are looked
+			/// up before any are resolved, and every service is resolved in the same resolution context.
+			/// @tparam TRequests The types of the services to request.
+			/// @param resolutionContext The resolution context.
+			/// @returns A tuple of the resolved services, in the order they were requested.
+			/// @throws SerumException If no matching binding exists for any of the requested services.
+			template <typename... TRequests>
+			[[nodiscard]] auto GetMany(ResolutionContext& resolutionContext)
+			{
+				return this->GetMany<TRequests...>(resolutionContext, std::array<std::string, sizeof...(TRequests)>{});
+			}
+
+			/// Resolves several named bound services from the container in a single call. All bindings are looked
+			/// up before any are resolved, and every service is resolved in the same resolution context.
+			/// @tparam TRequests The types of the services to request.
+			/// @param names The names of the bindings, in the same order as the requested types.
+			/// @returns A tuple of the resolved services, in the order they were requested.
+			/// @throws SerumException If no matching binding exists for any of the requested services.
+			template <typename... TRequests>
+			[[nodiscard]] auto GetMany(std::array<std::string, sizeof...(TRequests)> const& names)
+			{
+				auto resolutionContext = ResolutionContext();
+
+				return this->GetMany<TRequests...>(resolutionContext, names);
+			}
+
+			/// Resolves several named bound services from the container in a single call. All bindings are looked
+			/// up before any are resolved, and every service is resolved in the same resolution context.
+			/// @tparam TRequests The types of the services to request.
+			/// @param resolutionContext The resolution context.
+			/// @param names The names of the bindings, in the same order as the requested types.
+			/// @returns A tuple of the resolved services, in the order they were requested.
+			/// @throws SerumException If no matching binding exists for any of the requested services.
+			template <typename... TRequests>
+			[[nodiscard]] auto GetMany(
+				ResolutionContext& resolutionContext,
+				std::array<std::string, sizeof...(TRequests)> const& names)
+			{
+				return this->GetManyCore<TRequests...>(resolutionContext, names, std::index_sequence_for<TRequests...>{});
+			}
+
             /// Convenience function that calls Get with std::shared_ptr<TRequest>.
             /// @tparam TRequest The type of the shared pointer to request.
             /// @param name Optionally, the name of the binding.
             /// @returns The resolved service.
             /// @throws SerumException If no matching bindings exist.
             template <typename TRequest>
-            [[nodiscard]] auto GetSharedPointer(std::string const& name = "")
+            [[nodiscard]] std::shared_ptr<TRequest> GetSharedPointer(std::string const& name = "")
             {
                 auto resolutionContext = ResolutionContext();
 
@@ -66,11 +198,22 @@ namespace Serum
             /// @returns The resolved shared pointer service.
             /// @throws SerumException If no matching bindings exist.
             template <typename TRequest>
-            [[nodiscard]] auto GetSharedPointer(ResolutionContext& resolutionContext, std::string const& name = "")
+            [[nodiscard]] std::shared_ptr<TRequest> GetSharedPointer(ResolutionContext& resolutionContext, std::string const& name = "")
             {
                 return this->GetCore<std::shared_ptr<TRequest>>(resolutionContext, name);
             }
 
+			/// Resolves a constant or instance binding by reference, without copying the bound object.
+			/// @tparam TRequest The type of the service to request.
+			/// @param name Optionally, the name of the binding.
+			/// @returns A reference to the bound object, which is valid for as long as the binding.
+			/// @throws SerumException If no matching binding exists, or it is not a constant or instance binding.
+			template <typename TRequest>
+			[[nodiscard]] TRequest const& GetRef(std::string const& name = "") const
+			{
+				return GetRequiredBinding(typeid(TRequest), name).AsReferenceBinding<TRequest>().GetReference();
+			}
+
 			/// Gets the number of bindings that have been registered to the container.
 			/// @returns The number of bindings that have been registered to the container.
 			[[nodiscard]] auto GetNumberOfBindings() const noexcept
@@ -78,6 +221,68 @@ namespace Serum
 				return bindings.size();
 			}
 
+			/// Gets a graph of the bindings registered to the container. If the container's observer is an
+			/// Observers::DependencyGraphRecorder, the graph includes the dependencies it has observed.
+			/// @returns The dependency graph.
+			[[nodiscard]] DependencyGraph GetDependencyGraph() const
+			{
+#ifdef SERUM_HAS_OBSERVERS
+				if (auto const recorder = dynamic_cast<Observers::DependencyGraphRecorder const*>(observer.get()))
+				{
+					return GetDependencyGraph(*recorder);
+				}
+#endif
+
+				return DependencyGraph(GetDependencyGraphNodes(), {});
+			}
+
+			/// Exports a graph of the bindings registered to the container. If the container's observer is an
+			/// Observers::DependencyGraphRecorder, the graph includes the dependencies it has observed.
+			/// @param format The format to export the graph in.
+			/// @returns The exported graph.
+			[[nodiscard]] std::string ExportDependencyGraph(GraphFormat const format) const
+			{
+				return GetDependencyGraph().ToString(format);
+			}
+
+#ifdef SERUM_HAS_OBSERVERS
+			/// Gets a graph of the bindings registered to the container and the dependencies observed between them.
+			/// @param recorder The recorder which observed the dependencies.
+			/// @returns The dependency graph.
+			[[nodiscard]] DependencyGraph GetDependencyGraph(Observers::DependencyGraphRecorder const& recorder) const
+			{
+				return DependencyGraph(GetDependencyGraphNodes(), recorder.GetEdges());
+			}
+
+			/// Exports a graph of the bindings registered to the container and the dependencies observed between them.
+			/// @param format The format to export the graph in.
+			/// @param recorder The recorder which observed the dependencies.
+			/// @returns The exported graph.
+			[[nodiscard]] std::string ExportDependencyGraph(
+				GraphFormat const format,
+				Observers::DependencyGraphRecorder const& recorder) const
+			{
+				return GetDependencyGraph(recorder).ToString(format);
+			}
+#endif
+
+#ifdef SERUM_ENABLE_METRICS
+			/// Takes a snapshot of the resolution metrics of every binding in the container.
+			/// @returns The statistics of each binding, in no particular order.
+			[[nodiscard]] std::vector<Metrics::BindingStatistics> GetStatistics() const
+			{
+				auto statistics = std::vector<Metrics::BindingStatistics>();
+				statistics.reserve(bindings.size());
+
+				for (auto const& [key, binding] : bindings)
+				{
+					statistics.push_back(binding.GetBinding().GetMetrics().GetStatistics(key, binding.GetBindingType()));
+				}
+
+				return statistics;
+			}
+#endif
+
 			/// Checks whether a binding has been registered.
 			/// @tparam TRequest The type of the service to request.
 			/// @param name Optionally, the name of the binding.
@@ -90,7 +295,7 @@ namespace Serum
 			}
 
 			/// Binds the type to a constant value. When the type is requested, the container
-			/// will return a copy of the value.
+			/// will return a copy of the value. GetRef returns a reference to the value without copying it.
 			/// @tparam TRequest The type of the requested object.
 			/// @tparam TResolve The type of the constant to resolve. This must be convertible from TRequest.
 			/// @param value The value to return.
@@ -108,25 +313,62 @@ namespace Serum
 					std::is_convertible<TRequest, TResolve>::value,
 					"Cannot bind constant - the resolution type must be convertible from the request type.");
 
-				auto function = [value](ResolutionContext&) { return value; };
-				auto const binding = Bindings::FunctionBinding<TRequest>(function, name);
+				// Copy-initialization, so that only implicit conversions from the resolution type are allowed.
+				TRequest converted = value;
+				auto binding = Bindings::ConstantBinding<TRequest>(std::move(converted), name);
 
-				return this->BindCore(binding, name);
+				return this->BindCore(std::move(binding));
+			}
+
+			/// Binds the type to a constant value, moving the value into the binding. When the type is requested, the
+			/// container will return a copy of the value. GetRef returns a reference to the value without copying it.
+			/// @tparam TRequest The type of the requested object.
+			/// @param value The value to return.
+			/// @param name Optionally, a name for the binding.
+			/// @returns The container instance.
+			/// @throws SerumException If a binding of type TRequest with the given name already exists.
+			template <typename TRequest>
+			auto& BindConstant(TRequest&& value, std::string const& name = "")
+			{
+				static_assert(
+					std::is_move_constructible<TRequest>::value,
+					"Cannot bind constant - the request type must be move constructible.");
+
+				auto binding = Bindings::ConstantBinding<TRequest>(std::move(value), name);
+
+				return this->BindCore(std::move(binding));
+			}
+
+			/// Binds the type to an instance owned outside of the container. Neither binding nor resolving with GetRef
+			/// copies the instance. When the type is requested with Get, the container will return a copy of it.
+			/// The binding is keyed on the type without cv-qualifiers, so const instances are requested as TRequest.
+			/// @tparam TRequest The type of the requested object.
+			/// @param instance The instance. This must outlive the container.
+			/// @param name Optionally, a name for the binding.
+			/// @returns The container instance.
+			/// @throws SerumException If a binding of type TRequest with the given name already exists.
+			template <typename TRequest>
+			auto& BindInstance(TRequest& instance, std::string const& name = "")
+			{
+				auto binding = Bindings::InstanceBinding<std::remove_cv_t<TRequest>>(instance, name);
+
+				return this->BindCore(std::move(binding));
 			}
 
 			/// Binds the type to the result of a function. When the type is requested, the container will invoke
-			/// the function and return the result.
+			/// the function and return the result. The concrete type of the function is stored in the binding.
 			/// @tparam TRequest The type of the requested object.
+			/// @tparam TFunction The type of the function. This must be invocable with a ResolutionContext&.
 			/// @param function The function.
 			/// @param name Optionally, a name for the binding.
 			/// @returns The container instance.
 			/// @throws SerumException If a binding of type TRequest with the given name already exists.
-			template <typename TRequest>
-			auto& BindFunction(Bindings::ResolutionFunction<TRequest> const& function, std::string const& name = "")
+			template <typename TRequest, typename TFunction>
+			auto& BindFunction(TFunction function, std::string const& name = "")
 			{
-				auto const binding = Bindings::FunctionBinding<TRequest>(function, name);
+				auto binding = Bindings::MakeFunctionBinding<TRequest>(std::move(function), name);
 
-				return this->BindCore(binding, name);
+				return this->BindCore(std::move(binding));
 			}
 
 			/// Binds the type to a resolver. When the type is requested, the return value of the given resolver's
@@ -150,7 +392,7 @@ namespace Serum
 				auto const resolver = std::make_shared<TResolver>();
 				auto const binding = Bindings::ResolverBinding<TRequest>(resolver, name);
 
-				return this->BindCore(binding, name);
+				return this->BindCore(binding);
 			}
 
 			/// Binds the type to a resolver. When the type is requested, the return value of the given resolver's
@@ -175,33 +417,81 @@ namespace Serum
 				auto const resolver = std::make_shared<TResolver>(resolverInstance);
 				auto const binding = Bindings::ResolverBinding<TRequest>(resolver, name);
 
-				return this->BindCore(binding, name);
+				return this->BindCore(binding);
 			}
 
-			/// Binds the type to itself. When the type is requested, the resolver will return a new default instance
-			/// of the given type.
+#ifdef SERUM_HAS_COROUTINES
+			/// Binds the type to an asynchronous resolver. When the type is requested, the result of the
+			/// given resolver's Resolve coroutine will be returned.
+			/// @tparam TRequest The type of the requested object.
+			/// @tparam TResolver The type of the resolver.
 			/// @param name Optionally, a name for the binding.
+			/// @param resolverExecutor Optionally, the executor to resume the resolver on. If this is null,
+			/// the container's executor is used.
 			/// @returns The container instance.
 			/// @throws SerumException If a binding of type TRequest with the given name already exists.
-			template <typename TRequest>
-			auto& BindToSelf(std::string const& name = "")
+			template <typename TRequest, typename TResolver>
+			auto& BindAsyncResolver(
+				std::string const& name = "",
+				std::shared_ptr<Async::SerumExecutor> resolverExecutor = nullptr)
 			{
 				static_assert(
-					std::is_default_constructible<TRequest>::value,
-					"Could not bind type to self - Type must be default constructable.");
+					std::is_convertible<std::shared_ptr<TResolver>, std::shared_ptr<AsyncSerumResolver<TRequest>>>::value,
+					"Cannot bind resolver - TResolver is not convertible to AsyncSerumResolver.");
 
-				if constexpr (Internal::HasSerumConstructor<TRequest>::value)
-				{
-					auto const function = [this](ResolutionContext& context) { return *TRequest::SerumConstructor(*this, context); };
-					auto const binding = Bindings::FunctionBinding<TRequest>(function, name);
-					return this->BindCore(binding, name);
-				}
-				else
-				{
-					auto const function = [](ResolutionContext&) { return TRequest(); };
-					auto const binding = Bindings::FunctionBinding<TRequest>(function, name);
-					return this->BindCore(binding, name);
-				}
+				static_assert(
+					std::is_default_constructible<TResolver>::value,
+					"Cannot bind resolver - resolver type must be default constructible. Did you mean to pass an AsyncSerumResolver instance?");
+
+				auto const resolver = std::make_shared<TResolver>();
+				auto const binding = Bindings::AsyncResolverBinding<TRequest>(resolver, *this, std::move(resolverExecutor), name);
+
+				return this->BindCore(binding);
+			}
+
+			/// Binds the type to an asynchronous resolver. When the type is requested, the result of the
+			/// given resolver's Resolve coroutine will be returned.
+			/// @tparam TRequest The type of the requested object.
+			/// @tparam TResolver The type of the resolver.
+			/// @param resolverInstance The resolver instance.
+			/// @param name Optionally, a name for the binding.
+			/// @param resolverExecutor Optionally, the executor to resume the resolver on. If this is null,
+			/// the container's executor is used.
+			/// @returns The container instance.
+			/// @throws SerumException If a binding of type TRequest with the given name already exists.
+			template <typename TRequest, typename TResolver>
+			auto& BindAsyncResolver(
+				TResolver const& resolverInstance,
+				std::string const& name = "",
+				std::shared_ptr<Async::SerumExecutor> resolverExecutor = nullptr)
+			{
+				static_assert(
+					std::is_convertible<std::shared_ptr<TResolver>, std::shared_ptr<AsyncSerumResolver<TRequest>>>::value,
+					"Cannot bind resolver - TResolver is not convertible to AsyncSerumResolver.");
+
+				static_assert(
+					std::is_copy_constructible<TResolver>::value,
+					"Cannot bind resolver - type of resolver instance is not copy constructible.");
+
+				auto const resolver = std::make_shared<TResolver>(resolverInstance);
+				auto const binding = Bindings::AsyncResolverBinding<TRequest>(resolver, *this, std::move(resolverExecutor), name);
+
+				return this->BindCore(binding);
+			}
+#endif
+
+			/// Binds the type to itself. When the type is requested, the resolver will return a new instance of the given
+			/// type. The instance is created with the type's Serum constructor if it has one, otherwise by injecting its
+			/// declared SerumDependencies into its constructor, otherwise by default construction.
+			/// @param name Optionally, a name for the binding.
+			/// @returns The container instance.
+			/// @throws SerumException If a binding of type TRequest with the given name already exists.
+			template <typename TRequest>
+			auto& BindToSelf(std::string const& name = "")
+			{
+				auto const function = [this](ResolutionContext& context) { return this->ConstructValue<TRequest>(context); };
+				auto const binding = Bindings::MakeFunctionBinding<TRequest>(function, name);
+				return this->BindCore(binding);
 			}
 
 			/// Binds the type to a raw pointer. When the type is requested, the container will construct a new heap-allocated
@@ -219,18 +509,9 @@ namespace Serum
 					std::is_convertible<TResolve*, TRequest*>::value,
 					"Could not bind pointer - The resolution pointer type is not convertible to the request pointer type.");
 
-				if constexpr (Internal::HasSerumConstructor<TResolve>::value)
-				{
-					auto const function = [this](ResolutionContext& context) { return TResolve::SerumConstructor(*this, context); };
-					auto const binding = Bindings::FunctionBinding<TRequest*>(function, name);
-					return this->BindCore(binding, name);
-				}
-				else
-				{
-					auto const function = [](ResolutionContext&) { return new TResolve; };
-					auto const binding = Bindings::FunctionBinding<TRequest*>(function, name);
-					return this->BindCore(binding, name);
-				}
+				auto const function = [this](ResolutionContext& context) { return this->ConstructRawPointer<TResolve>(context); };
+				auto const binding = Bindings::MakeFunctionBinding<TRequest*>(function, name);
+				return this->BindCore(binding);
 			}
 
 			/// Binds the type to a std::shared_ptr instance. When the type is requested, the container will make a shared pointer
@@ -247,21 +528,12 @@ namespace Serum
 					std::is_convertible<std::shared_ptr<TResolve>, std::shared_ptr<TRequest>>::value,
 					"Could not bind shared pointer - The resolution pointer type is not convertible to the request pointer type.");
 
-				if constexpr (Internal::HasSerumConstructor<TResolve>::value)
-				{
-					auto const function = [this](ResolutionContext& context)
-					{
-					    return std::shared_ptr<TRequest>(TResolve::SerumConstructor(*this, context));
-					};
-					auto const binding = Bindings::FunctionBinding<std::shared_ptr<TRequest>>(function, name);
-					return this->BindCore(binding, name);
-				}
-				else
+				auto const function = [this](ResolutionContext& context)
 				{
-					auto const function = [](ResolutionContext&) { return std::make_shared<TResolve>(); };
-					auto const binding = Bindings::FunctionBinding<std::shared_ptr<TRequest>>(function, name);
-					return this->BindCore(binding, name);
-				}
+					return this->ConstructSharedPointer<TRequest, TResolve>(context);
+				};
+				auto const binding = Bindings::MakeFunctionBinding<std::shared_ptr<TRequest>>(function, name);
+				return this->BindCore(binding);
 			}
 
 			/// Binds the type to a raw pointer as a singleton. When the type is first requested, the container will construct a
@@ -279,20 +551,10 @@ namespace Serum
 					std::is_convertible<TResolve*, TRequest*>::value,
 					"Could not bind pointer - The resolution pointer type is not convertible to the request pointer type.");
 
-				if constexpr (Internal::HasSerumConstructor<TResolve>::value)
-				{
-					auto const function = [this](ResolutionContext& context) { return TResolve::SerumConstructor(*this, context); };
-					auto const innerBinding = Bindings::FunctionBinding<TRequest*>(function, name);
-					auto const binding = Bindings::SingletonBinding<TRequest*>(innerBinding);
-					return this->BindCore(binding, name);
-				}
-				else
-				{
-					auto const function = [](ResolutionContext&) { return new TResolve; };
-					auto const innerBinding = Bindings::FunctionBinding<TRequest*>(function, name);
-					auto const binding = Bindings::SingletonBinding<TRequest*>(innerBinding);
-					return this->BindCore(binding, name);
-				}
+				auto const function = [this](ResolutionContext& context) { return this->ConstructRawPointer<TResolve>(context); };
+				auto const innerBinding = Bindings::MakeFunctionBinding<TRequest*>(function, name);
+				auto const binding = Bindings::SingletonBinding<TRequest*>(innerBinding);
+				return this->BindCore(binding);
 			}
 
 			/// Binds the type to a std::shared_ptr instance as a singleton. When the type is first requested, the container will
@@ -310,102 +572,277 @@ namespace Serum
 					std::is_convertible<std::shared_ptr<TResolve>, std::shared_ptr<TRequest>>::value,
 					"Could not bind shared pointer - The resolution pointer type is not convertible to the request pointer type.");
 
+				auto const function = [this](ResolutionContext& context)
+				{
+					return this->ConstructSharedPointer<TRequest, TResolve>(context);
+				};
+				auto const innerBinding = Bindings::MakeFunctionBinding<std::shared_ptr<TRequest>>(function, name);
+				auto const binding = Bindings::SingletonBinding<std::shared_ptr<TRequest>>(innerBinding);
+				return this->BindCore(binding);
+			}
+
+			/// Binds the type to itself, resolved once per resolution. The first time the type is requested while
+			/// resolving a top-level Get, the container will construct a new instance of the given type. Every other
+			/// request made while resolving the same Get returns a copy of that instance.
+			/// @tparam TRequest The type of the requested object.
+			/// @param name Optionally, a name for the binding.
+			/// @returns The container instance.
+			/// @throws SerumException If a binding of type TRequest with the given name already exists.
+			template <typename TRequest>
+			auto& BindPerResolutionToSelf(std::string const& name = "")
+			{
+				auto const function = [this](ResolutionContext& context) { return this->ConstructValue<TRequest>(context); };
+				auto const innerBinding = Bindings::MakeFunctionBinding<TRequest>(function, name);
+				auto const binding = Bindings::PerResolutionBinding<TRequest>(innerBinding);
+				return this->BindCore(binding);
+			}
+
+			/// Binds the type to a std::shared_ptr instance, resolved once per resolution. The first time the type is
+			/// requested while resolving a top-level Get, the container will make a shared pointer of the resolution type.
+			/// Every other request made while resolving the same Get returns the same pointer.
+			/// @tparam TRequest The type of the requested object.
+			/// @tparam TResolve The type to resolve to. This must be convertible from TRequest.
+			/// @param name Optionally, a name for the binding.
+			/// @returns The container instance.
+			/// @throws SerumException If a binding of type TRequest with the given name already exists.
+			template <typename TRequest, typename TResolve = TRequest>
+			auto& BindPerResolutionSharedPointer(std::string const& name = "")
+			{
+				static_assert(
+					std::is_convertible<std::shared_ptr<TResolve>, std::shared_ptr<TRequest>>::value,
+					"Could not bind shared pointer - The resolution pointer type is not convertible to the request pointer type.");
+
+				auto const function = [this](ResolutionContext& context)
+				{
+					return this->ConstructSharedPointer<TRequest, TResolve>(context);
+				};
+				auto const innerBinding = Bindings::MakeFunctionBinding<std::shared_ptr<TRequest>>(function, name);
+				auto const binding = Bindings::PerResolutionBinding<std::shared_ptr<TRequest>>(innerBinding);
+				return this->BindCore(binding);
+			}
+
+		private:
+			template <typename TResolve>
+			TResolve ConstructValue(ResolutionContext& resolutionContext)
+			{
 				if constexpr (Internal::HasSerumConstructor<TResolve>::value)
 				{
-					auto const function = [this](ResolutionContext& context)
-					{
-						return std::shared_ptr<TRequest>(TResolve::SerumConstructor(*this, context));
-					};
-					auto const innerBinding = Bindings::FunctionBinding<std::shared_ptr<TRequest>>(function, name);
-					auto const binding = Bindings::SingletonBinding<std::shared_ptr<TRequest>>(innerBinding);
-					return this->BindCore(binding, name);
+					auto const instance = std::unique_ptr<TResolve>(TResolve::SerumConstructor(*this, resolutionContext));
+					return *instance;
 				}
 				else
 				{
-					auto const function = [](ResolutionContext&) { return std::make_shared<TResolve>(); };
-					auto const innerBinding = Bindings::FunctionBinding<std::shared_ptr<TRequest>>(function, name);
-					auto const binding = Bindings::SingletonBinding<std::shared_ptr<TRequest>>(innerBinding);
-					return this->BindCore(binding, name);
+					return Internal::Construct<TResolve>(*this, resolutionContext);
 				}
 			}
 
-		private:
-			[[nodiscard]] std::optional<Internal::AnyBindingWrapper> GetBinding(Bindings::BindingKey const& key) const
+			template <typename TResolve>
+			TResolve* ConstructRawPointer(ResolutionContext& resolutionContext)
 			{
-				auto const iterator = bindings.find(key);
+				if constexpr (Internal::HasSerumConstructor<TResolve>::value)
+				{
+					return TResolve::SerumConstructor(*this, resolutionContext);
+				}
+				else
+				{
+					return Internal::ConstructNew<TResolve>(*this, resolutionContext);
+				}
+			}
 
-				return iterator == bindings.end()
-					? std::nullopt
-					: std::optional<Internal::AnyBindingWrapper>(iterator->second);
+			template <typename TRequest, typename TResolve>
+			std::shared_ptr<TRequest> ConstructSharedPointer(ResolutionContext& resolutionContext)
+			{
+				if constexpr (Internal::HasSerumConstructor<TResolve>::value)
+				{
+					return std::shared_ptr<TRequest>(TResolve::SerumConstructor(*this, resolutionContext));
+				}
+				else
+				{
+					return Internal::ConstructShared<TResolve>(*this, resolutionContext);
+				}
 			}
 
-			void ThrowIfBindingExists(Bindings::BindingKey const& key) const
+			[[nodiscard]] std::vector<DependencyGraphNode> GetDependencyGraphNodes() const
 			{
-				auto const existingBinding = GetBinding(key);
+				auto nodes = std::vector<DependencyGraphNode>();
+				nodes.reserve(bindings.size());
 
-				if (existingBinding.has_value())
+				for (auto const& [key, binding] : bindings)
 				{
-					std::stringstream errorMessage;
-					errorMessage << "A binding already exists for " << key << ".\n";
+					auto const bindingType = binding.GetBindingType();
+					nodes.push_back(DependencyGraphNode{ key, bindingType, Bindings::GetBindingLifetime(bindingType) });
+				}
+
+				return nodes;
+			}
 
-					throw SerumException(errorMessage.str());
+			void ThrowIfBindingExists(Bindings::BindingKey const& key) const
+			{
+				if (bindings.find(key) != bindings.end())
+				{
+					ThrowBindingExists(key);
 				}
 			}
 
 			template <typename TBinding>
-			auto& BindCore(TBinding const& binding, std::string const& name)
+			auto& BindCore(TBinding binding)
 			{
 				auto const key = binding.GetBindingKey();
 				this->ThrowIfBindingExists(key);
-				bindings[key] = Internal::AnyBindingWrapper(binding);
+				bindings.emplace(key, Internal::AnyBindingWrapper(std::move(binding)));
 
 				return *this;
 			}
 
-			template <typename TRequest>
-			[[nodiscard]] auto GetCore(ResolutionContext& resolutionContext, std::string const& name)
+			// The lookup is shared by every Get instantiation rather than being inlined into each of them.
+			[[nodiscard]] SERUM_NOINLINE Internal::AnyBindingWrapper const& GetRequiredBinding(
+				std::type_info const& requestType,
+				std::string const& name) const
 			{
-				auto const key = Bindings::BindingKey(typeid(TRequest), name);
-				auto const optionalBinding = GetBinding(key);
+				auto const key = Bindings::BindingKey(requestType, name);
+				auto const iterator = bindings.find(key);
 
-				if (!optionalBinding.has_value())
+				if (iterator == bindings.end())
 				{
-					std::stringstream errorMessageStream;
-					errorMessageStream << "No binding registered for " << key << ".";
-					throw SerumException(errorMessageStream.str());
+					ThrowNoBindingRegistered(key);
 				}
 
-				const auto& binding = optionalBinding.value();
-				switch (binding.GetBindingType())
+				return iterator->second;
+			}
+
+			[[noreturn]] SERUM_NOINLINE SERUM_COLD static void ThrowBindingExists(Bindings::BindingKey const& key)
+			{
+				throw SerumException("A binding already exists for " + key.ToString() + ".\n");
+			}
+
+			[[noreturn]] SERUM_NOINLINE SERUM_COLD static void ThrowNoBindingRegistered(Bindings::BindingKey const& key)
+			{
+				throw SerumException("No binding registered for " + key.ToString() + ".");
+			}
+
+			void AttachObserver([[maybe_unused]] ResolutionContext& resolutionContext) const noexcept
+			{
+#ifdef SERUM_HAS_OBSERVERS
+				if (observer != nullptr && resolutionContext.GetObserver() == nullptr)
 				{
-					case Bindings::BindingType::Function:
-						return binding.AsFunctionBinding<TRequest>().Resolve(resolutionContext);
+					resolutionContext.SetObserver(observer.get());
+				}
+#endif
+			}
+
+#ifdef SERUM_HAS_TRACEPOINTS
+			// Fires the serum:get_begin tracepoint when created and the serum:get_end tracepoint when destroyed.
+			class GetTracepoint final
+			{
+				public:
+					GetTracepoint(char const* const typeName, std::string const& name) noexcept
+						: typeName(typeName), name(name)
+					{
+						SERUM_TRACEPOINT(get_begin, typeName, name.c_str());
+					}
 
-					case Bindings::BindingType::Resolver:
-						return binding.AsResolverBinding<TRequest>().Resolve(resolutionContext);
+					GetTracepoint(GetTracepoint const&) = delete;
 
-					case Bindings::BindingType::Singleton:
+					~GetTracepoint()
 					{
-						// This is currently a bit of a hack around the fact that the underlying bindings
-						// are returned by value. To make sure that the correct 'isResolved' value is set
-						// in the singleton binding we can just overwrite it here.
-
-						auto singletonBinding = binding.AsSingletonBinding<TRequest>();
-						auto result = singletonBinding.Resolve(resolutionContext);
-						bindings[key] = Internal::AnyBindingWrapper(singletonBinding);
-						return result;
+						SERUM_TRACEPOINT(get_end, typeName, name.c_str());
 					}
 
+					GetTracepoint& operator=(GetTracepoint const&) = delete;
+
+				private:
+					char const* typeName;
+					std::string const& name;
+			};
+#endif
+
+			template <typename TRequest>
+			[[nodiscard]] TRequest GetCore(ResolutionContext& resolutionContext, std::string const& name)
+			{
+#ifdef SERUM_HAS_TRACEPOINTS
+				auto const tracepoint = GetTracepoint(typeid(TRequest).name(), name);
+#endif
+
+				AttachObserver(resolutionContext);
+
+				return this->ResolveBinding<TRequest>(GetRequiredBinding(typeid(TRequest), name), resolutionContext);
+			}
+
+			template <typename... TRequests, std::size_t... Indices>
+			[[nodiscard]] auto GetManyCore(
+				ResolutionContext& resolutionContext,
+				std::array<std::string, sizeof...(TRequests)> const& names,
+				std::index_sequence<Indices...>)
+			{
+				AttachObserver(resolutionContext);
+
+				// All lookups are performed before anything is resolved so that a missing binding fails
+				// fast without partially constructing the batch, and so that the independent lookups can
+				// overlap with one another.
+
+				auto const batch = std::array<Internal::AnyBindingWrapper const*, sizeof...(TRequests)>
+				{
+					&GetRequiredBinding(typeid(TRequests), names[Indices])...
+				};
+
+				// Braced initialization guarantees that the bindings are resolved in order.
+				return std::tuple<TRequests...>
+				{
+					this->ResolveBinding<TRequests>(*batch[Indices], resolutionContext)...
+				};
+			}
+
+			template <typename TRequest>
+			[[nodiscard]] TRequest ResolveBinding(Internal::AnyBindingWrapper const& binding, ResolutionContext& resolutionContext)
+			{
+				// Bindings are stored once and resolved in place, so stateful bindings such as singletons
+				// keep their state without being written back.
+
+				return binding.AsBinding<TRequest>().Resolve(resolutionContext);
+			}
+
+#ifdef SERUM_HAS_COROUTINES
+			template <typename TRequest>
+			[[nodiscard]] Async::Task<TRequest> GetAsyncCore(ResolutionContext& resolutionContext, std::string name)
+			{
+				AttachObserver(resolutionContext);
+
+				auto& wrapper = GetRequiredBinding(typeid(TRequest), name);
+
+				if (wrapper.GetBindingType() == Bindings::BindingType::AsyncResolver)
+				{
+					auto& binding = wrapper.AsAsyncResolverBinding<TRequest>();
 
-					case Bindings::BindingType::Unknown:
-					default:
-						throw SerumException("Could not resolve binding. Binding type was unknown or invalid.");
+					co_return co_await binding.ResolveAsync(resolutionContext, executor.get());
 				}
+
+				co_return this->ResolveBinding<TRequest>(wrapper, resolutionContext);
 			}
 
+			/// The executor used to resume asynchronous resolutions.
+			std::shared_ptr<Async::SerumExecutor> executor = nullptr;
+#endif
+
+#ifdef SERUM_HAS_OBSERVERS
+			/// The observer notified of resolutions from the container.
+			std::shared_ptr<SerumObserver> observer = nullptr;
+#endif
+
 			/// Stores the bindings.
 			BindingCollection bindings{};
 	};
 }
 
+/// Declares that SerumContainer::Get is explicitly instantiated for the given type in another translation unit,
+/// so translation units which resolve the type do not instantiate it themselves. Use at global scope, and pair
+/// it with SERUM_INSTANTIATE_GET for the same type in exactly one translation unit.
+#define SERUM_EXTERN_GET(...) \
+	extern template __VA_ARGS__ Serum::SerumContainer::Get<__VA_ARGS__>(std::string const&); \
+	extern template __VA_ARGS__ Serum::SerumContainer::Get<__VA_ARGS__>(Serum::ResolutionContext&, std::string const&)
+
+/// Explicitly instantiates SerumContainer::Get for the given type. Use at global scope.
+#define SERUM_INSTANTIATE_GET(...) \
+	template __VA_ARGS__ Serum::SerumContainer::Get<__VA_ARGS__>(std::string const&); \
+	template __VA_ARGS__ Serum::SerumContainer::Get<__VA_ARGS__>(Serum::ResolutionContext&, std::string const&)
+
 #endif // SERUM_SERUM_CONTAINER_HPP
@@ -6,10 +6,12 @@
 
 #include "Serum/Internal/Common.hpp"
 
+#include <stdexcept>
+
 namespace Serum
 {
 	/// An exception type for the Serum library.
-	class SerumException final : public std::runtime_error
+	class SerumException : public std::runtime_error
 	{
 		public:
 			/// Initializes a new instance of the SerumException class.
@@ -0,0 +1,113 @@
+/// @file SerumFwd.hpp
+/// Forward declares the public Serum types. Include this instead of Serum.hpp in headers
+/// which only pass containers, contexts or resolvers around by reference or pointer.
+/// This header does not include any standard library headers.
+
+#ifndef SERUM_SERUM_FWD_HPP
+#define SERUM_SERUM_FWD_HPP
+
+#include "Serum/Internal/Config.hpp"
+
+namespace Serum
+{
+	class SerumException;
+	class CircularDependencyException;
+	class ResolutionContext;
+	class SerumContainer;
+	class DependencyGraph;
+
+	struct DependencyGraphNode;
+	struct DependencyGraphEdge;
+
+	enum class GraphFormat;
+
+	enum class ResolutionTracking;
+
+	template <typename TResolve>
+	class SerumResolver;
+
+	template <typename... TDependencies>
+	struct Dependencies;
+
+	template <typename... TBindings>
+	class StaticContainer;
+
+	namespace Bindings
+	{
+		class BindingKey;
+		class BindingBase;
+
+		enum class BindingType;
+		enum class BindingLifetime;
+
+		template <typename TRequest>
+		class Binding;
+
+		template <typename TRequest>
+		class ReferenceBinding;
+
+		template <typename TRequest>
+		class ConstantBinding;
+
+		template <typename TRequest>
+		class InstanceBinding;
+
+		template <typename TRequest>
+		class ResolverBinding;
+
+		template <typename TRequest>
+		class SingletonBinding;
+
+		template <typename TRequest>
+		class PerResolutionBinding;
+
+#ifdef SERUM_HAS_COROUTINES
+		template <typename TRequest>
+		class AsyncResolverBinding;
+#endif
+	}
+
+#ifdef SERUM_HAS_OBSERVERS
+	class SerumObserver;
+
+	namespace Observers
+	{
+		class CompositeObserver;
+		class DependencyGraphRecorder;
+		class FlightRecorder;
+		class ResolutionProfiler;
+		class TraceRecorder;
+
+		enum class FlightRecordType;
+		enum class ProfileTime;
+		enum class TraceEventType;
+
+		struct FlightRecord;
+		struct ProfiledStack;
+		struct TraceEvent;
+
+#ifdef SERUM_HAS_PERF_EVENTS
+		class HardwareCounterProfiler;
+
+		struct HardwareCounterStatistics;
+#endif
+	}
+#endif
+
+#ifdef SERUM_HAS_COROUTINES
+	template <typename TResolve>
+	class AsyncSerumResolver;
+
+	namespace Async
+	{
+		class SerumExecutor;
+		class InlineExecutor;
+		class ThreadPoolExecutor;
+
+		template <typename T>
+		class Task;
+	}
+#endif
+}
+
+#endif // SERUM_SERUM_FWD_HPP
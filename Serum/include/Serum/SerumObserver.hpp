@@ -0,0 +1,80 @@
+/// @file SerumObserver.hpp
+/// Defines a base type for observing bindings as they are resolved.
+
+#ifndef SERUM_SERUM_OBSERVER_HPP
+#define SERUM_SERUM_OBSERVER_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Bindings/BindingKey.hpp"
+
+#ifdef SERUM_HAS_OBSERVERS
+
+#include <chrono>
+
+namespace Serum
+{
+	/// Observes bindings as they are resolved. Observers are attached to a container with SerumContainer::SetObserver,
+	/// or to a single resolution context with ResolutionContext::SetObserver. Resolutions without an observer only pay
+	/// for a null pointer check. Every method does nothing by default, so observers only override the events they need.
+	/// Observers are called on the resolving thread, possibly from several threads at once, and must not throw.
+	class SerumObserver
+	{
+		public:
+			/// Public virtual destructor.
+			virtual ~SerumObserver() = default;
+
+			/// Called when a binding starts resolving, after it has been checked for circular dependencies.
+			/// @param key The key of the binding.
+			/// @param depth The number of observed resolutions in progress in the same context which this one is
+			/// nested within. This is 0 for a binding requested directly from a container.
+			virtual void OnResolveBegin(Bindings::BindingKey const& key, std::size_t depth)
+			{
+				(void)key;
+				(void)depth;
+			}
+
+			/// Called when a binding finishes resolving.
+			/// @param key The key of the binding.
+			/// @param duration The time taken to resolve the binding, including its dependencies.
+			/// @param succeeded Whether the binding was resolved, rather than throwing an exception.
+			virtual void OnResolveEnd(Bindings::BindingKey const& key, std::chrono::nanoseconds duration, bool succeeded)
+			{
+				(void)key;
+				(void)duration;
+				(void)succeeded;
+			}
+
+			/// Called when a singleton binding has constructed its instance, before OnResolveEnd is called for it.
+			/// @param key The key of the binding.
+			/// @param duration The time taken to construct the instance.
+			virtual void OnSingletonCreated(Bindings::BindingKey const& key, std::chrono::nanoseconds duration)
+			{
+				(void)key;
+				(void)duration;
+			}
+
+		protected:
+			/// Initializes a new instance of the SerumObserver class.
+			SerumObserver() noexcept = default;
+
+			/// Copy constructor.
+			/// @param observer The observer.
+			SerumObserver(SerumObserver const& observer) noexcept = default;
+
+			/// Move constructor.
+			/// @param observer The observer.
+			SerumObserver(SerumObserver&& observer) noexcept = default;
+
+			/// Copy assignment operator.
+			/// @param observer The observer.
+			SerumObserver& operator=(SerumObserver const& observer) noexcept = default;
+
+			/// Move assignment operator.
+			/// @param observer The observer.
+			SerumObserver& operator=(SerumObserver&& observer) noexcept = default;
+	};
+}
+
+#endif // SERUM_HAS_OBSERVERS
+
+#endif // SERUM_SERUM_OBSERVER_HPP
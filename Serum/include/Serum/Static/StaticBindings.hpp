@@ -0,0 +1,304 @@
+/// @file StaticBindings.hpp
+/// Defines type-level binding descriptions which can be composed into a StaticContainer.
+
+#ifndef SERUM_STATIC_STATIC_BINDINGS_HPP
+#define SERUM_STATIC_STATIC_BINDINGS_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Internal/TypeTraits.hpp"
+#include "Serum/Internal/Injection.hpp"
+#include "Serum/ResolutionContext.hpp"
+#include "Serum/SerumResolver.hpp"
+#include "Serum/Dependencies.hpp"
+
+#include <optional>
+
+namespace Serum::Static
+{
+	/// Binds the type to a constant value. When the type is requested, a copy of the value is returned.
+	/// @tparam TRequest The type of the requested object.
+	template <typename TRequest>
+	class Constant final
+	{
+		static_assert(
+			std::is_copy_constructible<TRequest>::value,
+			"Cannot bind constant - the request type must be copy constructible.");
+
+		public:
+			/// The type of the requested object.
+			using RequestType = TRequest;
+
+			/// The request types the binding depends on.
+			using DependencyTypes = Dependencies<>;
+
+			/// Initializes a new instance of the Constant class.
+			/// @param value The value to return.
+			explicit Constant(TRequest value)
+				: value(std::move(value))
+			{
+			}
+
+			/// Resolves the binding.
+			/// @returns A copy of the value.
+			template <typename TContainer>
+			[[nodiscard]] TRequest Resolve(TContainer&, ResolutionContext&) const
+			{
+				return value;
+			}
+
+		private:
+			TRequest value;
+	};
+
+	/// Binds the type to the result of a function. The function's concrete type is stored, so calls can be inlined.
+	/// @tparam TRequest The type of the requested object.
+	/// @tparam TFunction The type of the function. This must be invocable with a ResolutionContext&.
+	template <typename TRequest, typename TFunction>
+	class Function final
+	{
+		static_assert(
+			std::is_invocable_r<TRequest, TFunction&, ResolutionContext&>::value,
+			"Cannot bind function - the function must be invocable with a ResolutionContext& and return the request type.");
+
+		public:
+			/// The type of the requested object.
+			using RequestType = TRequest;
+
+			/// The request types the binding depends on.
+			using DependencyTypes = Dependencies<>;
+
+			/// Initializes a new instance of the Function class.
+			/// @param function The function.
+			explicit Function(TFunction function)
+				: function(std::move(function))
+			{
+			}
+
+			/// Resolves the binding.
+			/// @param resolutionContext The resolution context.
+			/// @returns The result of the function.
+			template <typename TContainer>
+			[[nodiscard]] TRequest Resolve(TContainer&, ResolutionContext& resolutionContext)
+			{
+				return function(resolutionContext);
+			}
+
+		private:
+			TFunction function;
+	};
+
+	/// Creates a function binding description, deducing the type of the function.
+	/// @tparam TRequest The type of the requested object.
+	/// @tparam TFunction The type of the function.
+	/// @param function The function.
+	/// @returns The binding description.
+	template <typename TRequest, typename TFunction>
+	[[nodiscard]] auto MakeFunction(TFunction function)
+	{
+		return Function<TRequest, TFunction>(std::move(function));
+	}
+
+	/// Binds the type to a resolver. The resolver's concrete type is stored, so calls can be devirtualized.
+	/// @tparam TRequest The type of the requested object.
+	/// @tparam TResolver The type of the resolver.
+	template <typename TRequest, typename TResolver>
+	class Resolver final
+	{
+		static_assert(
+			std::is_convertible<TResolver*, SerumResolver<TRequest>*>::value,
+			"Cannot bind resolver - TResolver is not convertible to SerumResolver.");
+
+		public:
+			/// The type of the requested object.
+			using RequestType = TRequest;
+
+			/// The request types the binding depends on.
+			using DependencyTypes = typename Internal::DependenciesOf<TResolver>::Type;
+
+			/// Initializes a new instance of the Resolver class with a default constructed resolver.
+			Resolver() = default;
+
+			/// Initializes a new instance of the Resolver class.
+			/// @param resolver The resolver instance.
+			explicit Resolver(TResolver resolver)
+				: resolver(std::move(resolver))
+			{
+			}
+
+			/// Resolves the binding.
+			/// @param resolutionContext The resolution context.
+			/// @returns The result of the resolver.
+			template <typename TContainer>
+			[[nodiscard]] TRequest Resolve(TContainer&, ResolutionContext& resolutionContext)
+			{
+				return resolver.TResolver::Resolve(resolutionContext);
+			}
+
+		private:
+			TResolver resolver{};
+	};
+
+	/// Binds the type to itself. When the type is requested, a new instance is returned. Types with a Serum
+	/// constructor are constructed using the static container's fallback container. Otherwise, declared
+	/// SerumDependencies are resolved from the static container and injected into the type's constructor.
+	/// @tparam TRequest The type of the requested object.
+	template <typename TRequest>
+	class ToSelf final
+	{
+		public:
+			/// The type of the requested object.
+			using RequestType = TRequest;
+
+			/// The request types the binding depends on.
+			using DependencyTypes = typename Internal::ConstructorDependenciesOf<TRequest>::Type;
+
+			/// Resolves the binding.
+			/// @param container The static container.
+			/// @param resolutionContext The resolution context.
+			/// @returns A new instance of the type.
+			/// @throws SerumException If the type has a Serum constructor but the container has no fallback.
+			template <typename TContainer>
+			[[nodiscard]] TRequest Resolve(TContainer& container, ResolutionContext& resolutionContext) const
+			{
+				if constexpr (Internal::HasSerumConstructor<TRequest>::value)
+				{
+					auto const instance = std::unique_ptr<TRequest>(
+						TRequest::SerumConstructor(container.GetFallback(), resolutionContext));
+
+					return *instance;
+				}
+				else
+				{
+					return Internal::Construct<TRequest>(container, resolutionContext);
+				}
+			}
+	};
+
+	/// Binds the type to a raw pointer. When the type is requested, a new heap-allocated instance of the resolution
+	/// type is returned. The pointer must later be deleted by the consumer.
+	/// @tparam TRequest The type of the requested object.
+	/// @tparam TResolve The type to resolve to. This must be convertible from TRequest.
+	template <typename TRequest, typename TResolve = TRequest>
+	class RawPointer final
+	{
+		static_assert(
+			std::is_convertible<TResolve*, TRequest*>::value,
+			"Could not bind pointer - The resolution pointer type is not convertible to the request pointer type.");
+
+		public:
+			/// The type of the requested object.
+			using RequestType = TRequest*;
+
+			/// The request types the binding depends on.
+			using DependencyTypes = typename Internal::ConstructorDependenciesOf<TResolve>::Type;
+
+			/// Resolves the binding.
+			/// @param container The static container.
+			/// @param resolutionContext The resolution context.
+			/// @returns A new heap-allocated instance of the resolution type.
+			/// @throws SerumException If the type has a Serum constructor but the container has no fallback.
+			template <typename TContainer>
+			[[nodiscard]] TRequest* Resolve(TContainer& container, ResolutionContext& resolutionContext) const
+			{
+				if constexpr (Internal::HasSerumConstructor<TResolve>::value)
+				{
+					return TResolve::SerumConstructor(container.GetFallback(), resolutionContext);
+				}
+				else
+				{
+					return Internal::ConstructNew<TResolve>(container, resolutionContext);
+				}
+			}
+	};
+
+	/// Binds the type to a std::shared_ptr instance. When the type is requested, a new shared pointer of the
+	/// resolution type is returned.
+	/// @tparam TRequest The type of the requested object.
+	/// @tparam TResolve The type to resolve to. This must be convertible from TRequest.
+	template <typename TRequest, typename TResolve = TRequest>
+	class SharedPointer final
+	{
+		static_assert(
+			std::is_convertible<std::shared_ptr<TResolve>, std::shared_ptr<TRequest>>::value,
+			"Could not bind shared pointer - The resolution pointer type is not convertible to the request pointer type.");
+
+		public:
+			/// The type of the requested object.
+			using RequestType = std::shared_ptr<TRequest>;
+
+			/// The request types the binding depends on.
+			using DependencyTypes = typename Internal::ConstructorDependenciesOf<TResolve>::Type;
+
+			/// Resolves the binding.
+			/// @param container The static container.
+			/// @param resolutionContext The resolution context.
+			/// @returns A new shared pointer of the resolution type.
+			/// @throws SerumException If the type has a Serum constructor but the container has no fallback.
+			template <typename TContainer>
+			[[nodiscard]] std::shared_ptr<TRequest> Resolve(TContainer& container, ResolutionContext& resolutionContext) const
+			{
+				if constexpr (Internal::HasSerumConstructor<TResolve>::value)
+				{
+					return std::shared_ptr<TRequest>(TResolve::SerumConstructor(container.GetFallback(), resolutionContext));
+				}
+				else
+				{
+					return Internal::ConstructShared<TResolve>(container, resolutionContext);
+				}
+			}
+	};
+
+	/// Wraps another binding description such that it is only resolved once and the same instance is always returned.
+	/// @tparam TBinding The binding description to wrap.
+	template <typename TBinding>
+	class Singleton final
+	{
+		public:
+			/// The type of the requested object.
+			using RequestType = typename TBinding::RequestType;
+
+			/// The request types the binding depends on.
+			using DependencyTypes = typename TBinding::DependencyTypes;
+
+			/// Initializes a new instance of the Singleton class.
+			/// @param binding The binding description to wrap.
+			explicit Singleton(TBinding binding = TBinding())
+				: binding(std::move(binding))
+			{
+			}
+
+			/// Resolves the binding, resolving the wrapped binding the first time only.
+			/// @param container The static container.
+			/// @param resolutionContext The resolution context.
+			/// @returns The resolved instance.
+			template <typename TContainer>
+			[[nodiscard]] RequestType Resolve(TContainer& container, ResolutionContext& resolutionContext)
+			{
+				if (!resolvedValue.has_value())
+				{
+					resolvedValue.emplace(binding.Resolve(container, resolutionContext));
+				}
+
+				return *resolvedValue;
+			}
+
+		private:
+			TBinding binding;
+			std::optional<RequestType> resolvedValue = std::nullopt;
+	};
+}
+
+namespace Serum::Internal
+{
+	/// Checks whether or not the binding description is a static singleton.
+	/// @tparam TBinding The binding description.
+	template <typename TBinding>
+	struct IsStaticSingleton final : std::false_type {};
+
+	/// Checks whether or not the binding description is a static singleton.
+	/// @tparam TBinding The wrapped binding description.
+	template <typename TBinding>
+	struct IsStaticSingleton<Static::Singleton<TBinding>> final : std::true_type {};
+}
+
+#endif // SERUM_STATIC_STATIC_BINDINGS_HPP
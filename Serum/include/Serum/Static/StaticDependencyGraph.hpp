@@ -0,0 +1,178 @@
+/// @file StaticDependencyGraph.hpp
+/// Defines compile-time lookup and dependency graph analysis over static binding descriptions.
+
+#ifndef SERUM_STATIC_STATIC_DEPENDENCY_GRAPH_HPP
+#define SERUM_STATIC_STATIC_DEPENDENCY_GRAPH_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Dependencies.hpp"
+
+#include <array>
+
+namespace Serum::Internal
+{
+	/// Counts the static binding descriptions which bind the given request type.
+	/// @tparam TRequest The request type.
+	/// @tparam TBindings The binding descriptions.
+	/// @returns The number of binding descriptions for the request type.
+	template <typename TRequest, typename... TBindings>
+	[[nodiscard]] constexpr std::size_t CountStaticBindings() noexcept
+	{
+		return (std::size_t(std::is_same<TRequest, typename TBindings::RequestType>::value) + ... + 0);
+	}
+
+	/// Gets the index of the static binding description which binds the given request type.
+	/// @tparam TRequest The request type.
+	/// @tparam TBindings The binding descriptions.
+	/// @returns The index of the binding description, or the number of descriptions if none match.
+	template <typename TRequest, typename... TBindings>
+	[[nodiscard]] constexpr std::size_t IndexOfStaticBinding() noexcept
+	{
+		constexpr bool matches[] = { false, std::is_same<TRequest, typename TBindings::RequestType>::value... };
+
+		for (auto i = std::size_t(0); i < sizeof...(TBindings); ++i)
+		{
+			if (matches[i + 1])
+			{
+				return i;
+			}
+		}
+
+		return sizeof...(TBindings);
+	}
+
+	/// Gets the indices of the static binding descriptions which bind each dependency in a Dependencies list.
+	/// @tparam TDependencies The Dependencies list.
+	/// @tparam TBindings The binding descriptions.
+	template <typename TDependencies, typename... TBindings>
+	struct StaticDependencyIndices;
+
+	/// Gets the indices of the static binding descriptions which bind each dependency in a Dependencies list.
+	/// @tparam TDependencies The request types of the dependencies.
+	/// @tparam TBindings The binding descriptions.
+	template <typename... TDependencies, typename... TBindings>
+	struct StaticDependencyIndices<Dependencies<TDependencies...>, TBindings...> final
+	{
+		/// The index of the binding for each dependency, or the number of bindings if a dependency is not bound.
+		static constexpr std::array<std::size_t, sizeof...(TDependencies)> Value =
+		{
+			IndexOfStaticBinding<TDependencies, TBindings...>()...
+		};
+	};
+
+	/// Checks whether every dependency in a Dependencies list is bound by one of the binding descriptions.
+	/// @tparam TDependencies The Dependencies list.
+	/// @tparam TBindings The binding descriptions.
+	/// @returns True if every dependency is bound, false otherwise.
+	template <typename TDependencies, typename... TBindings>
+	[[nodiscard]] constexpr bool AreStaticDependenciesBound() noexcept
+	{
+		for (auto const index : StaticDependencyIndices<TDependencies, TBindings...>::Value)
+		{
+			if (index == sizeof...(TBindings))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/// Computes the adjacency matrix of the dependency graph, where each binding description is a node with an edge
+	/// to the binding of each of its declared dependencies. Dependencies which are not bound have no edge.
+	/// @tparam TBindings The binding descriptions.
+	/// @returns The adjacency matrix, indexed by dependent and then dependency.
+	template <typename... TBindings>
+	[[nodiscard]] constexpr auto ComputeStaticDependencyMatrix() noexcept
+	{
+		constexpr auto numberOfBindings = sizeof...(TBindings);
+		auto matrix = std::array<std::array<bool, numberOfBindings>, numberOfBindings>{};
+		auto node = std::size_t(0);
+
+		// Unused when there are no bindings, as the fold expression below is then empty.
+		[[maybe_unused]] auto const addEdges = [&matrix, &node](auto const& dependencyIndices)
+		{
+			for (auto const index : dependencyIndices)
+			{
+				if (index < numberOfBindings)
+				{
+					matrix[node][index] = true;
+				}
+			}
+
+			++node;
+		};
+
+		(addEdges(StaticDependencyIndices<typename TBindings::DependencyTypes, TBindings...>::Value), ...);
+
+		return matrix;
+	}
+
+	/// An order in which static binding descriptions can be initialized.
+	/// @tparam NumberOfBindings The number of binding descriptions.
+	template <std::size_t NumberOfBindings>
+	struct StaticInitializationOrder final
+	{
+		/// The indices of the ordered binding descriptions. Only the first Count are valid.
+		std::array<std::size_t, NumberOfBindings> Indices{};
+
+		/// The number of ordered binding descriptions. This is less than NumberOfBindings if the graph has a cycle.
+		std::size_t Count = 0;
+	};
+
+	/// Computes an initialization order of the binding descriptions, such that every binding comes after the bindings
+	/// it depends on. Graphs are small, so every unplaced node is simply rechecked until no more can be placed;
+	/// the cubic worst case is cheaper to evaluate at compile time than maintaining in-degree counts.
+	/// @tparam TBindings The binding descriptions.
+	/// @returns The initialization order. Bindings in, or depending on, a dependency cycle are omitted.
+	template <typename... TBindings>
+	[[nodiscard]] constexpr auto ComputeStaticInitializationOrder() noexcept
+	{
+		constexpr auto numberOfBindings = sizeof...(TBindings);
+		constexpr auto matrix = ComputeStaticDependencyMatrix<TBindings...>();
+		auto order = StaticInitializationOrder<numberOfBindings>();
+		auto isPlaced = std::array<bool, numberOfBindings>{};
+		auto hasPlacedNode = true;
+
+		while (hasPlacedNode)
+		{
+			hasPlacedNode = false;
+
+			for (auto node = std::size_t(0); node < numberOfBindings; ++node)
+			{
+				auto canPlace = !isPlaced[node];
+				for (auto dependency = std::size_t(0); canPlace && dependency < numberOfBindings; ++dependency)
+				{
+					canPlace = !matrix[node][dependency] || isPlaced[dependency];
+				}
+
+				if (canPlace)
+				{
+					order.Indices[order.Count++] = node;
+					isPlaced[node] = true;
+					hasPlacedNode = true;
+				}
+			}
+		}
+
+		return order;
+	}
+
+	/// The dependency graph of a set of static binding descriptions, analysed at compile time.
+	/// @tparam TBindings The binding descriptions.
+	template <typename... TBindings>
+	struct StaticDependencyGraph final
+	{
+		/// Whether or not every declared dependency is bound by one of the binding descriptions.
+		static constexpr bool AllDependenciesBound =
+			(AreStaticDependenciesBound<typename TBindings::DependencyTypes, TBindings...>() && ...);
+
+		/// The initialization order of the binding descriptions.
+		static constexpr auto InitializationOrder = ComputeStaticInitializationOrder<TBindings...>();
+
+		/// Whether or not the graph is free of dependency cycles.
+		static constexpr bool IsAcyclic = InitializationOrder.Count == sizeof...(TBindings);
+	};
+}
+
+#endif // SERUM_STATIC_STATIC_DEPENDENCY_GRAPH_HPP
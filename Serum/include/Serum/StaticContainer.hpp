@@ -0,0 +1,200 @@
+/// @file StaticContainer.hpp
+/// Defines a container whose bindings are composed at compile time.
+
+#ifndef SERUM_STATIC_CONTAINER_HPP
+#define SERUM_STATIC_CONTAINER_HPP
+
+#include "Serum/Internal/Common.hpp"
+#include "Serum/Static/StaticBindings.hpp"
+#include "Serum/Static/StaticDependencyGraph.hpp"
+#include "Serum/SerumContainer.hpp"
+
+#include <array>
+#include <tuple>
+
+namespace Serum
+{
+	/// A container whose bindings are composed at compile time from the binding descriptions in Serum::Static.
+	/// Requests for statically bound types resolve to a direct call into the binding, without any hashing,
+	/// type erasure or virtual dispatch. Requests for other types, and all named requests, are forwarded to an
+	/// optional fallback SerumContainer.
+	/// Dependencies declared by bound types through a SerumDependencies alias are validated at compile time: every
+	/// dependency must be statically bound and the dependency graph must be acyclic.
+	/// @tparam TBindings The binding descriptions. Each request type may only be bound once.
+	template <typename... TBindings>
+	class StaticContainer final
+	{
+		public:
+			/// Checks at compile time whether the request type is statically bound.
+			/// @tparam TRequest The type of the service to request.
+			template <typename TRequest>
+			static constexpr bool IsStaticallyBound = (std::is_same<TRequest, typename TBindings::RequestType>::value || ...);
+
+			/// Initializes a new instance of the StaticContainer class without a fallback container.
+			/// @param bindings The binding descriptions.
+			explicit StaticContainer(TBindings... bindings)
+				: bindings(std::move(bindings)...)
+			{
+			}
+
+			/// Initializes a new instance of the StaticContainer class.
+			/// @param fallback The container to forward requests that are not statically bound to. This must outlive the
+			/// static container.
+			/// @param bindings The binding descriptions.
+			explicit StaticContainer(SerumContainer& fallback, TBindings... bindings)
+				: bindings(std::move(bindings)...),
+				  fallback(&fallback)
+			{
+			}
+
+			/// Resolves a service from the container.
+			/// @tparam TRequest The type of the service to request.
+			/// @returns The resolved service.
+			/// @throws SerumException If the type is not statically bound and cannot be resolved from the fallback.
+			template <typename TRequest>
+			[[nodiscard]] TRequest Get()
+			{
+				auto resolutionContext = ResolutionContext();
+
+				return this->Get<TRequest>(resolutionContext);
+			}
+
+			/// Resolves a service from the container.
+			/// @tparam TRequest The type of the service to request.
+			/// @param resolutionContext The resolution context.
+			/// @returns The resolved service.
+			/// @throws SerumException If the type is not statically bound and cannot be resolved from the fallback.
+			template <typename TRequest>
+			[[nodiscard]] TRequest Get(ResolutionContext& resolutionContext)
+			{
+				if constexpr (IsStaticallyBound<TRequest>)
+				{
+					return std::get<Internal::IndexOfStaticBinding<TRequest, TBindings...>()>(bindings).Resolve(*this, resolutionContext);
+				}
+				else
+				{
+					return GetFallback().template Get<TRequest>(resolutionContext);
+				}
+			}
+
+			/// Resolves a named service. Static bindings are never named, so an empty name resolves the same way as Get
+			/// without a name and any other name is resolved from the fallback container.
+			/// @tparam TRequest The type of the service to request.
+			/// @param name The name of the binding.
+			/// @returns The resolved service.
+			/// @throws SerumException If the request is not statically bound and there is no fallback or it has no
+			/// matching binding.
+			template <typename TRequest>
+			[[nodiscard]] TRequest Get(std::string const& name)
+			{
+				if constexpr (IsStaticallyBound<TRequest>)
+				{
+					if (name.empty())
+					{
+						return this->Get<TRequest>();
+					}
+				}
+
+				return GetFallback().template Get<TRequest>(name);
+			}
+
+			/// Convenience function that calls Get with std::shared_ptr<TRequest>.
+			/// @tparam TRequest The type of the shared pointer to request.
+			/// @returns The resolved shared pointer service.
+			/// @throws SerumException If the type is not statically bound and cannot be resolved from the fallback.
+			template <typename TRequest>
+			[[nodiscard]] std::shared_ptr<TRequest> GetSharedPointer()
+			{
+				return this->Get<std::shared_ptr<TRequest>>();
+			}
+
+			/// Checks whether a binding exists, either statically or in the fallback container.
+			/// @tparam TRequest The type of the service to request.
+			/// @param name Optionally, the name of the binding.
+			/// @returns Whether or not a binding of the request type and name exists.
+			template <typename TRequest>
+			[[nodiscard]] bool HasBinding(std::string const& name = "") const
+			{
+				if (name.empty() && IsStaticallyBound<TRequest>)
+				{
+					return true;
+				}
+
+				return fallback != nullptr && fallback->HasBinding<TRequest>(name);
+			}
+
+			/// Gets the number of static bindings.
+			/// @returns The number of static bindings.
+			[[nodiscard]] static constexpr std::size_t GetNumberOfStaticBindings() noexcept
+			{
+				return sizeof...(TBindings);
+			}
+
+			/// Gets the indices of the binding descriptions in an order where every binding comes after the bindings it
+			/// depends on.
+			/// @returns The initialization order.
+			[[nodiscard]] static constexpr std::array<std::size_t, sizeof...(TBindings)> GetInitializationOrder() noexcept
+			{
+				return DependencyGraph::InitializationOrder.Indices;
+			}
+
+			/// Eagerly resolves every static singleton binding in initialization order, so that later requests for them
+			/// never construct anything.
+			void InitializeSingletons()
+			{
+				auto resolutionContext = ResolutionContext();
+
+				InitializeSingletons(resolutionContext, std::make_index_sequence<sizeof...(TBindings)>());
+			}
+
+			/// Gets the fallback container.
+			/// @returns The fallback container.
+			/// @throws SerumException If the static container does not have a fallback.
+			[[nodiscard]] SerumContainer& GetFallback() const
+			{
+				if (fallback == nullptr)
+				{
+					throw SerumException("Cannot resolve binding - the static container does not have a fallback container.");
+				}
+
+				return *fallback;
+			}
+
+		private:
+			using DependencyGraph = Internal::StaticDependencyGraph<TBindings...>;
+
+			std::tuple<TBindings...> bindings;
+			SerumContainer* fallback = nullptr;
+
+			static_assert(
+				((Internal::CountStaticBindings<typename TBindings::RequestType, TBindings...>() == 1) && ...),
+				"Cannot create static container - each request type may only be bound once.");
+
+			static_assert(
+				DependencyGraph::AllDependenciesBound,
+				"Cannot create static container - a declared dependency is not statically bound.");
+
+			static_assert(
+				DependencyGraph::IsAcyclic,
+				"Cannot create static container - the declared dependencies contain a cycle.");
+
+			template <std::size_t... OrderPositions>
+			void InitializeSingletons(ResolutionContext& resolutionContext, std::index_sequence<OrderPositions...>)
+			{
+				(InitializeSingleton<DependencyGraph::InitializationOrder.Indices[OrderPositions]>(resolutionContext), ...);
+			}
+
+			template <std::size_t BindingIndex>
+			void InitializeSingleton(ResolutionContext& resolutionContext)
+			{
+				auto& binding = std::get<BindingIndex>(bindings);
+
+				if constexpr (Internal::IsStaticSingleton<std::decay_t<decltype(binding)>>::value)
+				{
+					static_cast<void>(binding.Resolve(*this, resolutionContext));
+				}
+			}
+	};
+}
+
+#endif // SERUM_STATIC_CONTAINER_HPP